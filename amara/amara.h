@@ -12,11 +12,15 @@
     #include <bitset>
     #include <map>
     #include <unordered_map>
+    #include <unordered_set>
     #include <vector>
     #include <deque>
     #include <list>
     #include <algorithm>
     #include <functional>
+    #if defined(__cpp_impl_coroutine)
+        #include <coroutine>
+    #endif
     #include <math.h>
     #include <random>
     #include <nlohmann/json.hpp>
@@ -121,6 +125,8 @@ namespace Amara {
 
 #include "amara_textureGeneration.cpp"
 #include "amara_random.cpp"
+#include "amara_coroutineScript.cpp"
+#include "amara_spatialIndex.cpp"
 
 #include "amara_actor.cpp"
 #include "amara_script.cpp"
@@ -134,6 +140,7 @@ namespace Amara {
 
 #include "amara_loadManager.cpp"
 #include "amara_loader.cpp"
+#include "amara_textureAtlas.cpp"
 
 #include "amara_music.cpp"
 #include "amara_sound.cpp"
@@ -157,13 +164,20 @@ namespace Amara {
 #include "amara_keyCodes.cpp"
 
 #include "amara_inputManager.cpp"
+#include "amara_inputRecorder.cpp"
 
 #include "amara_debugging.cpp"
+#include "amara_profiler.cpp"
+#include "amara_memoryArena.cpp"
+#include "amara_tweenSystem.cpp"
+#include "amara_entityIndex.cpp"
 #include "amara_taskManager.cpp"
 #include "amara_stateManager.cpp"
+#include "amara_propertyStore.cpp"
 
 #include "amara_messages.cpp"
 
+#include "amara_spriteBatch.cpp"
 #include "amara_gameProperties.cpp"
 
 #include "amara_fileWriter.cpp"
@@ -171,7 +185,10 @@ namespace Amara {
 
 #include "amara_fdeclarations.cpp"
 
+#include "amara_transform.cpp"
 #include "amara_geometry.cpp"
 #include "amara_easing.cpp"
 #include "amara_math.cpp"
-#include "amara_string.cpp"
\ No newline at end of file
+#include "amara_stringId.cpp"
+#include "amara_string.cpp"
+#include "amara_compaction.cpp"
\ No newline at end of file
@@ -8,8 +8,14 @@ namespace Amara {
     class Tween;
     class Actor: public Amara::Entity {
         public:
-            std::vector<Amara::Script*> scripts;
+            // Scripts run in recite order, linked through Script::nextScript.
+            Amara::Script* firstScript = nullptr;
+            Amara::Script* lastScript = nullptr;
+            // Bumped whenever scripts are removed outside of reciteScripts.
+            Uint32 scriptsVersion = 0;
+
             bool actingPaused = false;
+            bool pausedWhileDormant = false;
 
             Actor(): Amara::Entity() {}
 
@@ -20,55 +26,70 @@ namespace Amara {
             }
 
             virtual Amara::Script* recite(Amara::Script* script) {
-                scripts.push_back(script);
+                script->nextScript = nullptr;
+                if (lastScript) lastScript->nextScript = script;
+                else firstScript = script;
+                lastScript = script;
+
                 script->init(properties, this);
                 script->prepare();
                 script->prepare(this);
                 return script;
             }
 
+            template <class T, class... Args>
+            T* reciteNew(Args&&... args) {
+                T* script = new (arena) T(std::forward<Args>(args)...);
+                recite(script);
+                return script;
+            }
+
             virtual Amara::Script* chain(Amara::Script* script) {
-                if (scripts.size() > 0) {
-                    Amara::Script* lastScript = scripts.back();
-                    return lastScript->chain(script);
-                }
+                if (lastScript) return lastScript->chain(script);
                 return recite(script);
             }
 
+            /*
+             * Runs every script recited before this call, finished scripts are unlinked as they're found.
+             * Scripts recited while running, chained ones included, wait for the next tick.
+             */
             void reciteScripts() {
-                if (scripts.size() == 0 || actingPaused) return;
-                for (Amara::Script* script: scripts) {
+                if (firstScript == nullptr || actingPaused) return;
+                Uint32 version = scriptsVersion;
+                Amara::Script* last = lastScript;
+                Amara::Script* prev = nullptr;
+                Amara::Script* script = firstScript;
+                while (script) {
+                    Amara::Script* next = script->nextScript;
+                    bool wasLast = (script == last);
+
                     if (!script->finished) {
                         script->receiveMessages();
                         script->script();
                         script->script(this);
+                        if (version != scriptsVersion) return;
                     }
-                }
-
-                std::vector<Script*> chained;
-                chained.clear();
 
-                Amara::Script* script;
-                for (auto it = scripts.begin(); it != scripts.end(); ++it) {
-                    script = *it;
                     if (script->finished) {
-                        if (script->chainedScript != nullptr) {
-                            chained.push_back(script->chainedScript);
-                            script->chainedScript = nullptr;
-                        }
-                        scripts.erase(it--);
+                        unlinkScript(prev, script);
+                        Amara::Script* chained = script->unchain();
                         if (script->deleteOnFinish) {
                             delete script;
                         }
+                        if (chained) {
+                            recite(chained);
+                            if (version != scriptsVersion) return;
+                        }
                     }
-                }
-                for (Amara::Script* chain: chained) {
-                    recite(chain);
+                    else prev = script;
+
+                    if (wasLast) break;
+                    script = next;
                 }
             }
 
             bool stillActing() {
-                return (scripts.size() > 0);
+                return (firstScript != nullptr);
             }
 
             void run() {
@@ -81,33 +102,38 @@ namespace Amara {
             }
 
             void clearScripts() {
-                for (Amara::Script* script: scripts) {
+                Amara::Script* script = detachScripts();
+                while (script) {
+                    Amara::Script* next = script->nextScript;
+                    script->nextScript = nullptr;
                     if (script->deleteOnFinish) {
                         delete script;
                     }
+                    script = next;
                 }
-                scripts.clear();
             }
 
 			void clearScript(std::string gid) {
-				Amara::Script* script;
-                for (auto it = scripts.begin(); it != scripts.end(); ++it) {
-                    script = *it;
+				Amara::Script* prev = nullptr;
+                for (Amara::Script* script = firstScript; script; script = script->nextScript) {
                     if (script->id.compare(gid) == 0) {
-                        if (script->chainedScript != nullptr) {
-                            recite(script->chainedScript);
+                        unlinkScript(prev, script);
+                        scriptsVersion += 1;
+                        Amara::Script* chained = script->unchain();
+                        if (chained != nullptr) {
+                            recite(chained);
                         }
-                        scripts.erase(it--);
                         if (script->deleteOnFinish) {
                             delete script;
                         }
 						return;
                     }
+                    prev = script;
                 }
 			}
 
 			Amara::Script* getScript(std::string gid) {
-				for (Amara::Script* script: scripts) {
+				for (Amara::Script* script = firstScript; script; script = script->nextScript) {
 					if (script->id.compare(gid) == 0) {
 						return script;
 					}
@@ -116,26 +142,63 @@ namespace Amara {
 			}
 
 			void cancelScripts() {
-				for (Amara::Script* script: scripts) {
+				Amara::Script* script = detachScripts();
+				while (script) {
+                    Amara::Script* next = script->nextScript;
+                    script->nextScript = nullptr;
 					script->cancel();
 					script->cancel(this);
                     if (script->deleteOnFinish) {
                         delete script;
                     }
+                    script = next;
                 }
-                scripts.clear();
 			}
 
+            // Scripts hold still while dormant, unless they were already paused.
+            virtual void setDormant(bool dormant) {
+                if (isDormant == dormant) return;
+                if (dormant && !actingPaused) {
+                    pauseActing();
+                    pausedWhileDormant = true;
+                }
+                else if (!dormant && pausedWhileDormant) {
+                    resumeActing();
+                    pausedWhileDormant = false;
+                }
+                Amara::Entity::setDormant(dormant);
+            }
+
+            // Batched tweens on this actor hold still with its scripts.
             void pauseActing() {
                 actingPaused = true;
+                if (tweens) tweens->pause(this);
             }
             void resumeActing() {
                 actingPaused = false;
+                if (tweens) tweens->resume(this);
             }
 
             virtual ~Actor() {
                 clearScripts();
             }
+
+        private:
+            void unlinkScript(Amara::Script* prev, Amara::Script* script) {
+                if (prev) prev->nextScript = script->nextScript;
+                else firstScript = script->nextScript;
+                if (lastScript == script) lastScript = prev;
+                script->nextScript = nullptr;
+            }
+
+            // Empties the list and hands back its head, so scripts recited while it's walked start a new one.
+            Amara::Script* detachScripts() {
+                Amara::Script* script = firstScript;
+                firstScript = nullptr;
+                lastScript = nullptr;
+                scriptsVersion += 1;
+                return script;
+            }
     };
 }
 
@@ -61,13 +61,9 @@ namespace Amara {
             }
 
             void script() {
-                Amara::Actor* actor;
-                for (auto it = actors.begin(); it != actors.end(); ++it) {
-                    actor = *it;
-                    if (actor->isDestroyed) {
-                        actors.erase(it--);
-                    }
-                }
+                Amara::compact(actors, [](Amara::Actor* actor) {
+                    return actor->isDestroyed;
+                });
             }
 
             void finish() {
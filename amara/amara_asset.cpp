@@ -43,7 +43,13 @@ namespace Amara {
             int width = 0;
             int height = 0;
 
+            // Where the image starts in asset, non zero when it's a region of a TextureAtlas page.
+            int offsetX = 0;
+            int offsetY = 0;
+
             bool temp = false;
+            // Atlas pages belong to their TextureAtlas.
+            bool ownsTexture = true;
 
             SDL_Texture* asset = nullptr;
 
@@ -52,8 +58,17 @@ namespace Amara {
                 asset = givenAsset;
             }
 
+            ImageTexture(std::string key, AssetType givenType, SDL_Texture* page, SDL_Rect region): Amara::Asset(key, givenType, page) {
+                asset = page;
+                offsetX = region.x;
+                offsetY = region.y;
+                width = region.w;
+                height = region.h;
+                ownsTexture = false;
+            }
+
             ~ImageTexture() {
-                SDL_DestroyTexture(asset);
+                if (ownsTexture) SDL_DestroyTexture(asset);
             }
     };
 
@@ -87,7 +102,14 @@ namespace Amara {
             std::unordered_map<std::string, Amara::Animation*> anims;
 
             Spritesheet(std::string key, AssetType givenType, SDL_Texture* newtexture, int newwidth, int newheight): Amara::ImageTexture(key, givenType, newtexture) {
-                asset = newtexture;
+                setFrameSize(newwidth, newheight);
+            }
+
+            Spritesheet(std::string key, AssetType givenType, SDL_Texture* page, SDL_Rect region, int newwidth, int newheight): Amara::ImageTexture(key, givenType, page, region) {
+                setFrameSize(newwidth, newheight);
+            }
+
+            void setFrameSize(int newwidth, int newheight) {
                 frameWidth = newwidth;
                 frameHeight = newheight;
                 if (frameWidth > width) {
@@ -12,6 +12,10 @@ namespace Amara {
             std::vector<Amara::Camera*>* sceneCameras = nullptr;
             Amara::SceneTransitionBase* transition = nullptr;
 
+            // Set by the scene when it keeps a spatial index, only what's in view gets drawn.
+            Amara::SpatialIndex* spatialIndex = nullptr;
+            std::vector<Amara::Entity*> visibleEntities;
+
             bool definedDimensions = false;
 
             float width = 0;
@@ -22,6 +26,9 @@ namespace Amara {
             float scrollX = 0;
             float scrollY = 0;
 
+            float previousScrollX = 0;
+            float previousScrollY = 0;
+
             float oldZoomX = 0;
             float oldZoomY = 0;
             float zoomX = 1;
@@ -134,6 +141,21 @@ namespace Amara {
                 centerY = scrollY + (height/(zoomY*zoomScale))/2;
             }
 
+            void recordPreviousScroll() {
+                recordPreviousPosition();
+                previousScrollX = scrollX;
+                previousScrollY = scrollY;
+            }
+
+            float getInterpolatedScrollX() {
+                if (!hasPreviousPosition) return scrollX;
+                return previousScrollX + (scrollX - previousScrollX) * properties->interpolation;
+            }
+            float getInterpolatedScrollY() {
+                if (!hasPreviousPosition) return scrollY;
+                return previousScrollY + (scrollY - previousScrollY) * properties->interpolation;
+            }
+
             void recordValues() {
                 oldScrollX = scrollX;
                 oldScrollY = scrollY;
@@ -194,20 +216,26 @@ namespace Amara {
                 dh = (y + height > vh) ? ceil(vh - y) : height;
                 dh -= oh;
 
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, NULL);
 
-                std::vector<Amara::Entity*>& rSceneEntities = parent->entities;
+                std::vector<Amara::Entity*>& rSceneEntities = (spatialIndex) ? getVisibleEntities() : parent->entities;
+                // Containers put the view back once their children are drawn, so it's only set once.
+                assignAttributes();
+                bool entitiesRemoved = false;
                 Amara::Entity* entity;
                 for (std::vector<Amara::Entity*>::iterator it = rSceneEntities.begin(); it != rSceneEntities.end(); it++) {
                     entity = *it;
                     if (entity->isDestroyed || entity->scene != scene) {
-                        rSceneEntities.erase(it--);
+                        entitiesRemoved = true;
                         continue;
                     }
                     if (!entity->isVisible) continue;
-                    assignAttributes();
                     entity->draw(dx, dy, dw, dh);
                 }
+                if (entitiesRemoved) {
+                    parent->compactEntities();
+                }
 
                 if (transition != nullptr) {
                     transition->draw(dx, dy, dw, dh);
@@ -215,6 +243,7 @@ namespace Amara {
             }
 			void drawToTexture(SDL_Texture* tx) {
 				SDL_Texture* recTarget = SDL_GetRenderTarget(properties->gRenderer);
+				Amara::SpriteBatch::flush(properties);
 				SDL_SetRenderTarget(properties->gRenderer, tx);
 
 				float recX = x;
@@ -226,16 +255,29 @@ namespace Amara {
 				x = recX;
 				y = recY;
 
+				Amara::SpriteBatch::flush(properties);
 				SDL_SetRenderTarget(properties->gRenderer, recTarget);
 			}
 
+            // Scene entities whose bounds are in view, in the order the scene would draw them.
+            std::vector<Amara::Entity*>& getVisibleEntities() {
+                visibleEntities.clear();
+                float viewW = width/(zoomX*zoomScale);
+                float viewH = height/(zoomY*zoomScale);
+                float viewX = getInterpolatedScrollX() + offsetX/(zoomX*zoomScale);
+                float viewY = getInterpolatedScrollY() + offsetY/(zoomY*zoomScale);
+                spatialIndex->queryRect(viewX, viewY, viewW, viewH, visibleEntities, true);
+                std::sort(visibleEntities.begin(), visibleEntities.end(), sortByDrawOrder());
+                return visibleEntities;
+            }
+
             void assignAttributes() {
                 resetPassOnProperties();
                 properties->currentCamera = this;
-                properties->scrollX = scrollX + offsetX/(zoomX*zoomScale);
-                properties->scrollY = scrollY + offsetY/(zoomY*zoomScale);
-                properties->zoomX = zoomX * zoomScale;
-                properties->zoomY = zoomY * zoomScale;
+                properties->view.scrollX = getInterpolatedScrollX() + offsetX/(zoomX*zoomScale);
+                properties->view.scrollY = getInterpolatedScrollY() + offsetY/(zoomY*zoomScale);
+                properties->view.zoomX = zoomX * zoomScale;
+                properties->view.zoomY = zoomY * zoomScale;
             }
 
             void startFollow(Amara::Entity* entity, float lx, float ly) {
@@ -21,6 +21,7 @@ namespace Amara {
             bool clearEveryFrame = false;
 
             SDL_Color recColor;
+            Amara::Transform recView;
             SDL_Rect drawnRect;
             SDL_FRect destRect;
             SDL_Rect viewport;
@@ -45,6 +46,8 @@ namespace Amara {
 
             void init(Amara::GameProperties* gameProperties, Amara::Scene* gScene, Amara::Entity* gParent) {
                 drawImage.init(gameProperties, gScene, this);
+                // Copied straight onto the canvas texture, so it mustn't pick up the canvas's own transform.
+                drawImage.parent = nullptr;
                 properties = gameProperties;
                 if (canvas == nullptr) {
                     createNewCanvasTexture();
@@ -61,11 +64,13 @@ namespace Amara {
             void beginFill(Uint8 r, Uint8 g, Uint8 b, Uint8 a, SDL_BlendMode gBlendMode) {
                 recTarget = SDL_GetRenderTarget(properties->gRenderer);
 
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, canvas);
                 SDL_GetRenderDrawColor(properties->gRenderer, &recColor.r, &recColor.g, &recColor.b, &recColor.a);
                 SDL_SetRenderDrawColor(properties->gRenderer, r, g, b, a);
                 SDL_SetRenderDrawBlendMode(properties->gRenderer, gBlendMode);
 
+                recView = properties->view;
                 resetPassOnProperties();
                 
             } 
@@ -80,7 +85,9 @@ namespace Amara {
             }
 
             void endFill() {
+                properties->view = recView;
                 SDL_SetRenderDrawColor(properties->gRenderer, recColor.r, recColor.g, recColor.b, recColor.a);
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, recTarget);
             }
 
@@ -118,6 +125,8 @@ namespace Amara {
                 drawnRect.y = ry;
                 drawnRect.w = rw;
                 drawnRect.h = rh;
+                // Sprites copied since beginFill() are still batched and have to land first.
+                Amara::SpriteBatch::flush(properties);
                 SDL_RenderFillRect(properties->gRenderer, &drawnRect);
             }
 
@@ -213,14 +222,16 @@ namespace Amara {
                 viewport.y = vy;
                 viewport.w = vw;
                 viewport.h = vh;
+                Amara::SpriteBatch::flush(properties);
                 SDL_RenderSetViewport(properties->gRenderer, &viewport);
 
-                float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-                float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY; 
-                destRect.x = ((x - properties->scrollX*scrollFactorX + properties->offsetX - (originX * imageWidth * scaleX)) * nzoomX);
-                destRect.y = ((y-z - properties->scrollY*scrollFactorY + properties->offsetY - (originY * imageHeight * scaleY)) * nzoomY);
-                destRect.w = ((imageWidth * scaleX) * properties->zoomX);
-                destRect.h = ((imageHeight * scaleY) * properties->zoomY);
+                Amara::Transform transform = getDrawTransform();
+                float nzoomX = transform.getZoomX(zoomFactorX);
+                float nzoomY = transform.getZoomY(zoomFactorY); 
+                destRect.x = ((transform.getScreenX(x, scrollFactorX) - (originX * imageWidth * scaleX)) * nzoomX);
+                destRect.y = ((transform.getScreenY(y-z, scrollFactorY) - (originY * imageHeight * scaleY)) * nzoomY);
+                destRect.w = ((imageWidth * scaleX) * transform.zoomX);
+                destRect.h = ((imageHeight * scaleY) * transform.zoomY);
 
                 if (pixelLocked) {
                     destRect.x = floor(destRect.x);
@@ -265,14 +276,14 @@ namespace Amara {
                 if (!skipDrawing) {
                     if (canvas != nullptr) {
                         SDL_SetTextureBlendMode(canvas, blendMode);
-				        SDL_SetTextureAlphaMod(canvas, alpha * properties->alpha * 255);
+				        SDL_SetTextureAlphaMod(canvas, alpha * transform.alpha * 255);
 
                         SDL_RenderCopyExF(
                             properties->gRenderer,
                             canvas,
                             NULL,
                             &destRect,
-                            angle + properties->angle,
+                            angle + transform.angle,
                             &origin,
                             SDL_FLIP_NONE
                         );
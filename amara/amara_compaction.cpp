@@ -0,0 +1,28 @@
+#pragma once
+#ifndef AMARA_COMPACTION
+#define AMARA_COMPACTION
+
+#include "amara.h"
+
+namespace Amara {
+    /*
+     * Removes every element shouldRemove() returns true for in one linear pass, keeping the order of the rest.
+     * shouldRemove() is called exactly once per element in order, so it can release what it removes.
+     * Loops skip removed elements and compact once afterwards instead of erasing while iterating.
+     */
+    template <class T, class Predicate>
+    size_t compact(std::vector<T>& list, Predicate shouldRemove) {
+        size_t kept = 0;
+        size_t size = list.size();
+        for (size_t i = 0; i < size; i++) {
+            if (shouldRemove(list[i])) continue;
+            if (kept != i) list[kept] = std::move(list[i]);
+            kept += 1;
+        }
+        if (kept == size) return 0;
+        list.erase(list.begin() + kept, list.end());
+        return size - kept;
+    }
+}
+
+#endif
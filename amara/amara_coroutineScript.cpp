@@ -0,0 +1,232 @@
+#pragma once
+#ifndef AMARA_COROUTINESCRIPT
+#define AMARA_COROUTINESCRIPT
+
+#include "amara.h"
+
+// Needs a C++20 build (-std=c++20), the rest of the engine doesn't depend on it.
+#if defined(__cpp_impl_coroutine)
+
+namespace Amara {
+    class CoroutineScript;
+
+    class ScriptRoutine {
+        public:
+            struct promise_type {
+                // Frames share the script pool, which lives as long as the program.
+                static void* operator new(size_t size) {
+                    return Amara::MemoryArena::allocate(getScriptPool(), size);
+                }
+                static void operator delete(void* ptr) {
+                    Amara::MemoryArena::deallocate(ptr);
+                }
+
+                Amara::ScriptRoutine get_return_object() {
+                    return Amara::ScriptRoutine(std::coroutine_handle<promise_type>::from_promise(*this));
+                }
+                std::suspend_always initial_suspend() noexcept { return {}; }
+                std::suspend_always final_suspend() noexcept { return {}; }
+                void return_void() {}
+                void unhandled_exception() { std::terminate(); }
+            };
+
+            std::coroutine_handle<promise_type> handle;
+
+            ScriptRoutine() {}
+            ScriptRoutine(std::coroutine_handle<promise_type> gHandle) {
+                handle = gHandle;
+            }
+
+            ScriptRoutine(const ScriptRoutine&) = delete;
+            ScriptRoutine& operator=(const ScriptRoutine&) = delete;
+
+            ScriptRoutine(ScriptRoutine&& other) {
+                handle = other.handle;
+                other.handle = nullptr;
+            }
+            ScriptRoutine& operator=(ScriptRoutine&& other) {
+                if (this != &other) {
+                    if (handle) handle.destroy();
+                    handle = other.handle;
+                    other.handle = nullptr;
+                }
+                return *this;
+            }
+
+            bool done() {
+                return !handle || handle.done();
+            }
+
+            ~ScriptRoutine() {
+                if (handle) handle.destroy();
+            }
+    };
+
+    enum CoroutineWaitType {
+        COROUTINE_READY = 0,
+        COROUTINE_TICKS,
+        COROUTINE_SCRIPT,
+        COROUTINE_MESSAGE,
+        COROUTINE_CONDITION
+    };
+
+    // Returned by the CoroutineScript wait methods, co_await on a message gives back the message.
+    struct ScriptAwaiter {
+        Amara::CoroutineScript* script = nullptr;
+
+        bool await_ready();
+        void await_suspend(std::coroutine_handle<>) {}
+        Amara::Message& await_resume();
+    };
+
+    /*
+     * Script written as one coroutine instead of evt() blocks, e.g.
+     *     Amara::ScriptRoutine routine() {
+     *         co_await wait(1);
+     *         co_await tween(new Tween_XY(64, 64, 0.5));
+     *         Amara::Message& msg = co_await message("doorOpened");
+     *         finish();
+     *     }
+     * Each tick only checks what the routine is waiting on and resumes it from there.
+     * Returning from the routine finishes the script, chaining works like any other script.
+     */
+    class CoroutineScript: public Amara::Script {
+        public:
+            Amara::ScriptRoutine routineTask;
+            bool started = false;
+
+            int waitType = COROUTINE_READY;
+            int waitTicks = 0;
+            Amara::Script* waitScript = nullptr;
+            Amara::StringId waitChannel = 0;
+            Amara::Message* waitMessage = nullptr;
+            // Sequence of the last message handed to the routine, waits only take ones published after it.
+            Uint64 lastMessageSequence = 0;
+            std::function<bool()> waitCondition;
+
+            CoroutineScript(bool deleteWhenDone): Amara::Script(deleteWhenDone) {}
+            CoroutineScript(): CoroutineScript(true) {}
+
+            virtual Amara::ScriptRoutine routine() = 0;
+
+            void script() {
+                if (finished) return;
+                if (!started) {
+                    started = true;
+                    routineTask = routine();
+                }
+                if (!isReady()) return;
+                clearWait();
+                routineTask.handle.resume();
+                if (routineTask.done() && !finished) finish();
+            }
+
+            // Resumes after the given time, wait(0) resumes next tick.
+            Amara::ScriptAwaiter wait(float seconds) {
+                float lps = (properties != nullptr) ? properties->lps : 60;
+                waitType = COROUTINE_TICKS;
+                waitTicks = ceil(lps * seconds);
+                if (waitTicks < 1) waitTicks = 1;
+                return { this };
+            }
+
+            Amara::ScriptAwaiter nextTick() {
+                return wait(0);
+            }
+
+            // Recites the script on the parent and resumes once it has finished.
+            Amara::ScriptAwaiter tween(Amara::Script* gScript) {
+                waitScript = gScript;
+                waitScript->awaitedBy = this;
+                waitType = COROUTINE_SCRIPT;
+                parent->recite(gScript);
+                return { this };
+            }
+
+            void onAwaitedDeleted(Amara::Script* gScript) {
+                if (waitScript == gScript) waitScript = nullptr;
+            }
+
+            // Each wait resumes on a message newer than the one the last wait returned.
+            Amara::ScriptAwaiter message(Amara::StringId channel) {
+                waitType = COROUTINE_MESSAGE;
+                waitChannel = channel;
+                return { this };
+            }
+            Amara::ScriptAwaiter message(std::string key) {
+                return message(Amara::hashString(key));
+            }
+
+            Amara::ScriptAwaiter until(std::function<bool()> condition) {
+                waitType = COROUTINE_CONDITION;
+                waitCondition = condition;
+                return { this };
+            }
+
+            // Called once a tick while suspended.
+            bool isReady() {
+                switch (waitType) {
+                    case COROUTINE_TICKS:
+                        waitTicks -= 1;
+                        return waitTicks <= 0;
+                    case COROUTINE_SCRIPT:
+                        return waitScript == nullptr || waitScript->finished;
+                    case COROUTINE_MESSAGE: {
+                        Amara::Message& msg = properties->messages->getAfter(waitChannel, lastMessageSequence);
+                        if (msg.isNull) return false;
+                        waitMessage = &msg;
+                        lastMessageSequence = msg.sequence;
+                        return true;
+                    }
+                    case COROUTINE_CONDITION:
+                        return waitCondition();
+                }
+                return true;
+            }
+
+            // Checked straight away by co_await, so a message already sent or a condition already met doesn't cost a tick.
+            bool isReadyNow() {
+                switch (waitType) {
+                    case COROUTINE_MESSAGE:
+                    case COROUTINE_CONDITION:
+                        return isReady();
+                }
+                return false;
+            }
+
+            Amara::Message& takeMessage() {
+                Amara::Message* msg = waitMessage;
+                waitMessage = nullptr;
+                if (msg == nullptr) return Amara::MessageBus::nullMessage;
+                return *msg;
+            }
+
+            void clearWait() {
+                if (waitScript) {
+                    waitScript->awaitedBy = nullptr;
+                    waitScript = nullptr;
+                }
+                waitType = COROUTINE_READY;
+                waitCondition = nullptr;
+            }
+
+            virtual ~CoroutineScript() {
+                if (waitScript) waitScript->awaitedBy = nullptr;
+            }
+    };
+
+    bool ScriptAwaiter::await_ready() {
+        if (script->isReadyNow()) {
+            script->clearWait();
+            return true;
+        }
+        return false;
+    }
+
+    Amara::Message& ScriptAwaiter::await_resume() {
+        return script->takeMessage();
+    }
+}
+
+#endif
+#endif
@@ -10,32 +10,258 @@ namespace Amara {
         SINE_INOUT,
         SINE_IN,
         SINE_OUT,
-        SINE_INOUT_BACKROUND
+        SINE_INOUT_BACKROUND,
+        QUAD_IN,
+        QUAD_OUT,
+        QUAD_INOUT,
+        CUBIC_IN,
+        CUBIC_OUT,
+        CUBIC_INOUT,
+        EXPO_IN,
+        EXPO_OUT,
+        EXPO_INOUT,
+        BACK_IN,
+        BACK_OUT,
+        BACK_INOUT,
+        ELASTIC_IN,
+        ELASTIC_OUT,
+        ELASTIC_INOUT,
+        BOUNCE_IN,
+        BOUNCE_OUT,
+        BOUNCE_INOUT,
+        EASING_COUNT
     };
 
+    /*
+     * Easing policies, each maps progress 0 to 1 onto the eased amount through a static at().
+     * Pass one as a template argument to pick the curve at compile time, e.g.
+     *     x = Amara::ease<Amara::BackOut>(startX, targetX, progress);
+     */
+    struct LinearEasing {
+        static constexpr double at(double t) { return t; }
+    };
+
+    struct SineInOut {
+        static double at(double t) { return (sin(-M_PI/2 + t*M_PI) + 1)/2; }
+    };
+    struct SineIn {
+        static double at(double t) { return sin(-M_PI/2 + t*M_PI/2) + 1; }
+    };
+    struct SineOut {
+        static double at(double t) { return sin(t*M_PI/2); }
+    };
+    // Goes out and comes back to the start.
+    struct SineInOutBackRound {
+        static double at(double t) { return (sin(-M_PI/2 + t*M_PI*2) + 1)/2; }
+    };
+    struct SineHardInOut {
+        static double at(double t) { return sin(M_PI*t); }
+    };
+
+    struct QuadIn {
+        static constexpr double at(double t) { return t*t; }
+    };
+    struct QuadOut {
+        static constexpr double at(double t) { return 1 - (1 - t)*(1 - t); }
+    };
+    struct QuadInOut {
+        static constexpr double at(double t) {
+            return (t < 0.5) ? 2*t*t : 1 - (2 - 2*t)*(2 - 2*t)/2;
+        }
+    };
+
+    struct CubicIn {
+        static constexpr double at(double t) { return t*t*t; }
+    };
+    struct CubicOut {
+        static constexpr double at(double t) { return 1 - (1 - t)*(1 - t)*(1 - t); }
+    };
+    struct CubicInOut {
+        static constexpr double at(double t) {
+            return (t < 0.5) ? 4*t*t*t : 1 - (2 - 2*t)*(2 - 2*t)*(2 - 2*t)/2;
+        }
+    };
+
+    struct ExpoIn {
+        static double at(double t) { return (t <= 0) ? 0 : pow(2, 10*t - 10); }
+    };
+    struct ExpoOut {
+        static double at(double t) { return (t >= 1) ? 1 : 1 - pow(2, -10*t); }
+    };
+    struct ExpoInOut {
+        static double at(double t) {
+            if (t <= 0) return 0;
+            if (t >= 1) return 1;
+            return (t < 0.5) ? pow(2, 20*t - 10)/2 : (2 - pow(2, -20*t + 10))/2;
+        }
+    };
+
+    // Overshoots by about 10% before settling.
+    struct BackIn {
+        static constexpr double at(double t) { return 2.70158*t*t*t - 1.70158*t*t; }
+    };
+    struct BackOut {
+        static constexpr double at(double t) { return 1 + 2.70158*(t - 1)*(t - 1)*(t - 1) + 1.70158*(t - 1)*(t - 1); }
+    };
+    struct BackInOut {
+        static constexpr double at(double t) {
+            return (t < 0.5)
+                ? (2*t)*(2*t)*((2.5949095 + 1)*2*t - 2.5949095)/2
+                : ((2*t - 2)*(2*t - 2)*((2.5949095 + 1)*(2*t - 2) + 2.5949095) + 2)/2;
+        }
+    };
+
+    struct ElasticIn {
+        static double at(double t) {
+            if (t <= 0) return 0;
+            if (t >= 1) return 1;
+            return -pow(2, 10*t - 10)*sin((10*t - 10.75)*(2*M_PI/3));
+        }
+    };
+    struct ElasticOut {
+        static double at(double t) {
+            if (t <= 0) return 0;
+            if (t >= 1) return 1;
+            return pow(2, -10*t)*sin((10*t - 0.75)*(2*M_PI/3)) + 1;
+        }
+    };
+    struct ElasticInOut {
+        static double at(double t) {
+            if (t <= 0) return 0;
+            if (t >= 1) return 1;
+            if (t < 0.5) return -(pow(2, 20*t - 10)*sin((20*t - 11.125)*(2*M_PI/4.5)))/2;
+            return (pow(2, -20*t + 10)*sin((20*t - 11.125)*(2*M_PI/4.5)))/2 + 1;
+        }
+    };
+
+    struct BounceOut {
+        static constexpr double at(double t) {
+            return (t < 1/2.75) ? 7.5625*t*t
+                : (t < 2/2.75) ? 7.5625*(t - 1.5/2.75)*(t - 1.5/2.75) + 0.75
+                : (t < 2.5/2.75) ? 7.5625*(t - 2.25/2.75)*(t - 2.25/2.75) + 0.9375
+                : 7.5625*(t - 2.625/2.75)*(t - 2.625/2.75) + 0.984375;
+        }
+    };
+    struct BounceIn {
+        static constexpr double at(double t) { return 1 - BounceOut::at(1 - t); }
+    };
+    struct BounceInOut {
+        static constexpr double at(double t) {
+            return (t < 0.5) ? (1 - BounceOut::at(1 - 2*t))/2 : (1 + BounceOut::at(2*t - 1))/2;
+        }
+    };
+
+    /*
+     * Samples a policy once into a table and reads it back with linear interpolation,
+     * for curves that cost a sin or pow per call. Works as a policy itself, e.g.
+     *     Amara::ease<Amara::EasingTable<Amara::ElasticOut>>(startX, targetX, progress);
+     */
+    template <class Policy, int Size = 256>
+    class EasingTable {
+        public:
+            static double at(double t) {
+                const double* values = getValues();
+                if (t <= 0) return values[0];
+                if (t >= 1) return values[Size - 1];
+                double pos = t*(Size - 1);
+                int i = (int)pos;
+                return values[i] + (values[i + 1] - values[i])*(pos - i);
+            }
+
+        private:
+            struct Values {
+                double values[Size];
+                Values() {
+                    for (int i = 0; i < Size; i++) values[i] = Policy::at((double)i/(Size - 1));
+                }
+            };
+
+            static const double* getValues() {
+                static Values table;
+                return table.values;
+            }
+    };
+
+    template <class Policy>
+    double ease(float startVal, float endVal, double progress) {
+        return startVal + (endVal - startVal)*Policy::at(progress);
+    }
+
+    // Eases a whole array at once, the curve is fixed for the loop so it compiles down to one tight pass.
+    template <class Policy>
+    void easeAll(const double* progress, double* eased, size_t count) {
+        for (size_t i = 0; i < count; i++) eased[i] = Policy::at(progress[i]);
+    }
+
+    template <class Policy>
+    void easeAll(const double* progress, double* eased, size_t count, bool useTable) {
+        if (useTable) easeAll<Amara::EasingTable<Policy>>(progress, eased, count);
+        else easeAll<Policy>(progress, eased, count);
+    }
+
+    // Only branches on the easing once per call.
+    void easeAll(Amara::Easing easing, const double* progress, double* eased, size_t count, bool useTables) {
+        switch (easing) {
+            case SINE_INOUT: easeAll<Amara::SineInOut>(progress, eased, count, useTables); break;
+            case SINE_IN: easeAll<Amara::SineIn>(progress, eased, count, useTables); break;
+            case SINE_OUT: easeAll<Amara::SineOut>(progress, eased, count, useTables); break;
+            case SINE_INOUT_BACKROUND: easeAll<Amara::SineInOutBackRound>(progress, eased, count, useTables); break;
+            case QUAD_IN: easeAll<Amara::QuadIn>(progress, eased, count); break;
+            case QUAD_OUT: easeAll<Amara::QuadOut>(progress, eased, count); break;
+            case QUAD_INOUT: easeAll<Amara::QuadInOut>(progress, eased, count); break;
+            case CUBIC_IN: easeAll<Amara::CubicIn>(progress, eased, count); break;
+            case CUBIC_OUT: easeAll<Amara::CubicOut>(progress, eased, count); break;
+            case CUBIC_INOUT: easeAll<Amara::CubicInOut>(progress, eased, count); break;
+            case EXPO_IN: easeAll<Amara::ExpoIn>(progress, eased, count, useTables); break;
+            case EXPO_OUT: easeAll<Amara::ExpoOut>(progress, eased, count, useTables); break;
+            case EXPO_INOUT: easeAll<Amara::ExpoInOut>(progress, eased, count, useTables); break;
+            case BACK_IN: easeAll<Amara::BackIn>(progress, eased, count); break;
+            case BACK_OUT: easeAll<Amara::BackOut>(progress, eased, count); break;
+            case BACK_INOUT: easeAll<Amara::BackInOut>(progress, eased, count); break;
+            case ELASTIC_IN: easeAll<Amara::ElasticIn>(progress, eased, count, useTables); break;
+            case ELASTIC_OUT: easeAll<Amara::ElasticOut>(progress, eased, count, useTables); break;
+            case ELASTIC_INOUT: easeAll<Amara::ElasticInOut>(progress, eased, count, useTables); break;
+            case BOUNCE_IN: easeAll<Amara::BounceIn>(progress, eased, count); break;
+            case BOUNCE_OUT: easeAll<Amara::BounceOut>(progress, eased, count); break;
+            case BOUNCE_INOUT: easeAll<Amara::BounceInOut>(progress, eased, count); break;
+            default: easeAll<Amara::LinearEasing>(progress, eased, count); break;
+        }
+    }
+
+    // Single value version of easeAll(), for code that picks the easing at runtime.
+    double easeAt(Amara::Easing easing, double progress) {
+        double eased = 0;
+        easeAll(easing, &progress, &eased, 1, false);
+        return eased;
+    }
+
+    double ease(Amara::Easing easing, float startVal, float endVal, double progress) {
+        return startVal + (endVal - startVal)*easeAt(easing, progress);
+    }
+
     double linearEase(float startVal, float endVal, double progress) {
-        return startVal + (endVal - startVal)*progress;
-    }   
+        return ease<Amara::LinearEasing>(startVal, endVal, progress);
+    }
 
     double sineInOutEase(float startVal, float endVal, double progress) {
-        return startVal + (endVal - startVal)*(sin(-M_PI/2 + progress*M_PI) + 1)/2;
+        return ease<Amara::SineInOut>(startVal, endVal, progress);
     }
 
     double sineOutEase(float startVal, float endVal, double progress) {
-        return startVal + (endVal - startVal)*(sin(progress*M_PI/2));
+        return ease<Amara::SineOut>(startVal, endVal, progress);
     }
 
     double sineInEase(float startVal, float endVal, double progress) {
-        return startVal + (endVal - startVal)*(sin(-M_PI/2 + progress*M_PI/2) + 1);
+        return ease<Amara::SineIn>(startVal, endVal, progress);
     }
 
     double sineInOutBackRoundEase(float startVal, float endVal, double progress) {
-        return startVal + (endVal - startVal)*(sin(-M_PI/2 + progress*M_PI*2) + 1)/2;
+        return ease<Amara::SineInOutBackRound>(startVal, endVal, progress);
     }
 
     double sineHardInOutEase(float startVal, float endVal, double progress) {
-        return startVal + (endVal - startVal)*(sin(M_PI * progress));
+        return ease<Amara::SineHardInOut>(startVal, endVal, progress);
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -26,7 +26,7 @@ namespace Amara {
 		TilemapLayer* tilemapLayer;
 	} PhysicsProperties;
 
-	class PhysicsBase {
+	class PhysicsBase: public Amara::Pooled {
 		public:
 			Amara::GameProperties* gameProperties = nullptr;
 			Entity* parent = nullptr;
@@ -104,25 +104,17 @@ namespace Amara {
 			}
 
 			Amara::PhysicsBase* removeCollisionTarget(Amara::PhysicsBase* gBody) {
-				Amara::PhysicsBase* other;
-				for (auto it = collisionTargets.begin(); it != collisionTargets.end(); ++it) {
-					other = *it;
-					if (other == gBody) {
-						collisionTargets.erase(it--);
-					}
-				}
+				Amara::compact(collisionTargets, [gBody](Amara::PhysicsBase* other) {
+					return other == gBody;
+				});
 				return gBody;
 			}
 			virtual Amara::PhysicsBase* removeCollisionTarget(Amara::Entity* other) {}
 
 			void checkActiveCollisionTargets() {
-				Amara::PhysicsBase* other;
-				for (auto it = collisionTargets.begin(); it != collisionTargets.end(); ++it) {
-					other = *it;
-					if (other->isDestroyed) {
-						collisionTargets.erase(it--);
-					}
-				}
+				Amara::compact(collisionTargets, [](Amara::PhysicsBase* other) {
+					return other->isDestroyed;
+				});
 			}
 
 			void activate() {
@@ -148,6 +140,8 @@ namespace Amara {
 			void removeBounds() {
 				lockedToBounds = false;
 			}
+
+			virtual ~PhysicsBase() {}
 	};
 
 	class SortedEntity {
@@ -161,7 +155,52 @@ namespace Amara {
 		}
 	};
 
-	class Entity : public Amara::SortedEntity, public Amara::Interactable {
+	/*
+	 * Stable depth sort for child lists that are almost always already in order.
+	 * The in-order check is linear, a few moved entities are fixed with an insertion sort,
+	 * anything that turns into a reshuffle falls back to stable_sort.
+	 */
+	template <class T>
+	void sortByDepth(std::vector<T*>& list) {
+		size_t size = list.size();
+		if (size < 2) return;
+
+		size_t i = 1;
+		while (i < size && !(list[i]->depth < list[i-1]->depth)) i += 1;
+		if (i == size) return;
+
+		size_t maxShifts = size * 4 + 64;
+		size_t shifts = 0;
+		for (; i < size; i++) {
+			T* item = list[i];
+			size_t j = i;
+			while (j > 0 && item->depth < list[j-1]->depth) {
+				list[j] = list[j-1];
+				j -= 1;
+			}
+			list[j] = item;
+			shifts += i - j;
+			if (shifts > maxShifts) {
+				stable_sort(list.begin(), list.end(), sortEntities());
+				return;
+			}
+		}
+	}
+
+	// Where an entity sits in its scene's SpatialIndex, owned by the index.
+	struct SpatialEntry {
+		bool indexed = false;
+		bool bounded = false;
+		Amara::FloatRect bounds;
+		Amara::IntRect cells;
+		Uint32 queryStamp = 0;
+		bool boundsChanged = false;
+	};
+
+	// Counts every init() so entities at the same depth keep the order they were added in.
+	Uint64 entityAddSequence = 0;
+
+	class Entity : public Amara::SortedEntity, public Amara::Interactable, public Amara::Pooled {
 		public:
 			Amara::GameProperties* properties = nullptr;
 			Amara::Game*  game = nullptr;
@@ -177,15 +216,42 @@ namespace Amara {
 			Amara::AudioGroup* audio = nullptr;
 			Amara::AssetManager* assets = nullptr;
 			Amara::Loader* load = nullptr;
-			Amara::MessageQueue* messages = nullptr;
+			Amara::MessageBus* messages = nullptr;
 
 			std::vector<Amara::Entity*> entities;
 
 			Amara::PhysicsBase* physics = nullptr;
+
+			// Index of this entity's world transform in properties->transforms, -1 until it's first needed.
+			int transformSlot = -1;
+
+			// Children created with addNew() are allocated from here, inherited from the parent.
+			Amara::MemoryArena* arena = nullptr;
+
+			Amara::SpatialEntry spatialEntry;
+			// The spatial index only bounds these once, call markBoundsChanged() after moving one.
+			bool staticBounds = false;
+			Uint64 addSequence = 0;
+
+			// Scene wide lookup by id and tag, inherited from the parent.
+			Amara::EntityIndex* entityIndex = nullptr;
+			Amara::StringId indexedId = 0;
+			std::vector<Amara::StringId> tags;
+
+			// The scene's batched tweens, inherited from the parent.
+			Amara::TweenSystem* tweens = nullptr;
+
 			bool pushedMessages = false;
+			bool subscribed = false;
 
 			nlohmann::json data;
+			/*
+			 * Typed fast path next to data. A key lives in one or the other: once a key is set here,
+			 * configure() loads it here and toData() writes it back out into "data".
+			 */
+			Amara::PropertyStore vars;
 
+			// Prefer setId() once the entity has been added, ids assigned directly are only found by a slower scan.
 			std::string id;
 			std::string entityType;
 
@@ -207,10 +273,24 @@ namespace Amara {
 			float angle = 0;
 			float alpha = 1;
 
+			// Position at the start of the last logic tick, used to draw between ticks.
+			float previousX = 0;
+			float previousY = 0;
+			float previousZ = 0;
+			bool hasPreviousPosition = false;
+
+			// Y-sorting, depth is set from y every tick so the parent's sort stays nearly in order.
+			bool depthFollowsY = false;
+			float depthOffsetY = 0;
+
 			bool isActive = false;
 			bool isDestroyed = false;
 			bool isVisible = true;
 
+			// Dormant entities are outside their scene's activity regions and don't run.
+			bool isDormant = false;
+			bool alwaysActive = false;
+
 			Entity() {}
 
 			virtual void init(Amara::GameProperties* gameProperties, Amara::Scene* givenScene, Amara::Entity* givenParent) {
@@ -220,6 +300,12 @@ namespace Amara {
 				game = properties->game;
 				scene = givenScene;
 				parent = givenParent;
+				if (givenParent != nullptr) {
+					arena = givenParent->arena;
+					tweens = givenParent->tweens;
+					setEntityIndex(givenParent->entityIndex);
+				}
+				addSequence = ++entityAddSequence;
 
 				input = properties->input;
 				controls = properties->controls;
@@ -243,8 +329,14 @@ namespace Amara {
 
 			virtual void configure(nlohmann::json config) {
 				if (config.find("id") != config.end()) {
-                    id = config["id"];
+                    setId(config["id"]);
                 }
+				if (config.find("tags") != config.end()) {
+					for (nlohmann::json& tag: config["tags"]) {
+						if (tag.is_number_unsigned()) addTag(tag.get<Amara::StringId>());
+						else addTag(tag.get<std::string>());
+					}
+				}
 
 				if (config.find("x") != config.end()) {
 					x = config["x"];
@@ -322,6 +414,15 @@ namespace Amara {
 				if (config.find("depth") != config.end()) {
 					depth = config["depth"];
 				}
+				if (config.find("depthFollowsY") != config.end()) {
+					depthFollowsY = config["depthFollowsY"];
+				}
+				if (config.find("depthOffsetY") != config.end()) {
+					depthOffsetY = config["depthOffsetY"];
+				}
+				if (config.find("alwaysActive") != config.end()) {
+					alwaysActive = config["alwaysActive"];
+				}
 				if (config.find("cameraOffsetX") != config.end()) {
 					cameraOffsetX = config["cameraOffsetX"];
 				}
@@ -329,7 +430,10 @@ namespace Amara {
 					cameraOffsetY = config["cameraOffsetY"];
 				}
 				if (config.find("data") != config.end()) {
-					data.update(config["data"]);
+					nlohmann::json& configData = config["data"];
+					for (auto& item: configData.items()) {
+						if (!vars.read(item.key(), item.value())) data[item.key()] = item.value();
+					}
 				}
 				if (config.find("bringToFront") != config.end()) {
 					if (config["bringToFront"]) {
@@ -346,6 +450,14 @@ namespace Amara {
 			virtual nlohmann::json toData() {
 				nlohmann::json config;
 				config["id"] = id;
+				if (!tags.empty()) {
+					config["tags"] = nlohmann::json::array();
+					// Tags added as hashed ids without their name are kept as the id, configure() reads both.
+					for (Amara::StringId tag: tags) {
+						if (Amara::StringIds::isKnown(tag)) config["tags"].push_back(Amara::StringIds::name(tag));
+						else config["tags"].push_back(tag);
+					}
+				}
 				config["entityType"] = entityType;
 				config["x"] = x;
 				config["y"] = y;
@@ -358,18 +470,113 @@ namespace Amara {
 				config["isVisible"] = isVisible;
 				config["alpha"] = alpha;
 				config["depth"] = depth;
+				config["alwaysActive"] = alwaysActive;
 				config["cameraOffsetX"] = cameraOffsetX;
 				config["cameraOffsetY"] = cameraOffsetY;
 				config["data"] = data;
+				vars.writeJson(config["data"]);
 				return config;
 			}
 			
 			Amara::Entity* setId(std::string newId) {
 				id = newId;
+				Amara::StringId newIndexedId = toIndexedId(id);
+				if (entityIndex) entityIndex->changeId(this, indexedId, newIndexedId);
+				indexedId = newIndexedId;
 				return this;
 			}
 
+			// Ids that were never interned save as their number rather than their name.
+			Amara::Entity* addTag(Amara::StringId tag) {
+				if (hasTag(tag)) return this;
+				tags.push_back(tag);
+				if (entityIndex) entityIndex->addTag(this, tag);
+				return this;
+			}
+			Amara::Entity* addTag(std::string tag) {
+				return addTag(Amara::StringIds::intern(tag));
+			}
+
+			Amara::Entity* removeTag(Amara::StringId tag) {
+				for (size_t i = 0; i < tags.size(); i++) {
+					if (tags[i] == tag) {
+						tags.erase(tags.begin() + i);
+						if (entityIndex) entityIndex->removeTag(this, tag);
+						break;
+					}
+				}
+				return this;
+			}
+			Amara::Entity* removeTag(std::string tag) {
+				return removeTag(Amara::hashString(tag));
+			}
+
+			bool hasTag(Amara::StringId tag) {
+				for (Amara::StringId entityTag: tags) {
+					if (entityTag == tag) return true;
+				}
+				return false;
+			}
+			bool hasTag(std::string tag) {
+				return hasTag(Amara::hashString(tag));
+			}
+
+			// Any entity in the scene with the id, not just direct children.
+			Amara::Entity* findById(Amara::StringId gId) {
+				if (entityIndex == nullptr) return nullptr;
+				for (Amara::Entity* entity: entityIndex->getById(gId)) {
+					if (!entity->isDestroyed) return entity;
+				}
+				return nullptr;
+			}
+			Amara::Entity* findById(std::string gId) {
+				if (entityIndex == nullptr) return nullptr;
+				for (Amara::Entity* entity: entityIndex->getById(Amara::hashString(gId))) {
+					if (!entity->isDestroyed && entity->id.compare(gId) == 0) return entity;
+				}
+				return nullptr;
+			}
+
+			/*
+			 * Every entity in the scene with the tag, in no particular order.
+			 * Destroying or untagging entities changes the list, copy it first to do that while iterating.
+			 */
+			std::vector<Amara::Entity*>& getTagged(Amara::StringId tag) {
+				if (entityIndex == nullptr) return noEntities;
+				return entityIndex->getTagged(tag);
+			}
+			std::vector<Amara::Entity*>& getTagged(std::string tag) {
+				return getTagged(Amara::hashString(tag));
+			}
+
+			// Moves this entity and its children into another scene's index, or out of any with nullptr.
+			void setEntityIndex(Amara::EntityIndex* gIndex) {
+				if (entityIndex == gIndex) return;
+				if (entityIndex) entityIndex->remove(this, indexedId, tags);
+				entityIndex = gIndex;
+				indexedId = toIndexedId(id);
+				if (entityIndex) entityIndex->add(this, indexedId, tags);
+
+				for (Amara::Entity* child: entities) {
+					if (child->isDestroyed || child->parent != this) continue;
+					child->setEntityIndex(gIndex);
+				}
+			}
+
+			/*
+			 * Tweens one of this entity's fields through the scene's tween system, without a script.
+			 * e.g. tweenTo(alpha, 0, 0.5, SINE_OUT), an invalid handle is returned outside a scene.
+			 */
+			Amara::TweenHandle tweenTo(float& field, float target, double time, Amara::Easing easing) {
+				if (tweens == nullptr) return Amara::TweenHandle();
+				return tweens->add(this, &field, target, time, easing);
+			}
+			Amara::TweenHandle tweenTo(float& field, float target, double time) {
+				return tweenTo(field, target, time, LINEAR);
+			}
+
 			bool hasDataProperty(std::string gKey) {
+				if (vars.has(Amara::hashString(gKey))) return true;
 				if (data.find(gKey) != data.end()) {
 					return true;
 				} 
@@ -377,12 +584,34 @@ namespace Amara {
 			}
 
 			bool isDataProperty(std::string gKey) {
-				if (hasDataProperty(gKey) && data[gKey].is_boolean() && data[gKey]) {
+				Amara::StringId key = Amara::hashString(gKey);
+				if (vars.has(key)) return vars.isTrue(key);
+				if (data.find(gKey) != data.end() && data[gKey].is_boolean() && data[gKey]) {
 					return true;
 				}
 				return false;
 			}
 
+			/*
+			 * World space rect this entity draws into, with its children.
+			 * Returns false when that can't be known up front, the entity is then always drawn.
+			 */
+			virtual bool getDrawBounds(Amara::FloatRect& bounds) {
+				return false;
+			}
+
+			// Grows bounds to cover the rect rotated by angle around the pivot.
+			void padBoundsForAngle(Amara::FloatRect& bounds, float pivotX, float pivotY) {
+				if (angle == 0) return;
+				float dx = fmax(pivotX - bounds.x, bounds.x + bounds.width - pivotX);
+				float dy = fmax(pivotY - bounds.y, bounds.y + bounds.height - pivotY);
+				float reach = sqrt(dx*dx + dy*dy);
+				bounds.x = pivotX - reach;
+				bounds.y = pivotY - reach;
+				bounds.width = reach*2;
+				bounds.height = reach*2;
+			}
+
 			virtual void draw(int vx, int vy, int vw, int vh) {
 				if (properties->quit) return;
 				if (physics) {
@@ -392,41 +621,68 @@ namespace Amara {
 				if (alpha < 0) alpha = 0;
                 if (alpha > 1) alpha = 1;
 
-				float recScrollX = properties->scrollX * scrollFactorX;
-				float recScrollY = properties->scrollY * scrollFactorY;
-				float recOffsetX = properties->offsetX + x;
-				float recOffsetY = properties->offsetY + y;
-				float recZoomX = properties->zoomX * scaleX;
-				float recZoomY = properties->zoomY * scaleY;
-				float recZoomFactorX = properties->zoomFactorX * zoomFactorX;
-				float recZoomFactorY = properties->zoomFactorY * zoomFactorY;
-				float recAngle = properties->angle + angle;
-				float recAlpha = properties->alpha * alpha;
+				updateWorldTransform();
+				if (entities.empty()) return;
 
-				stable_sort(entities.begin(), entities.end(), sortEntities());
+				sortByDepth(entities);
 
+				bool childrenRemoved = false;
 				Amara::Entity* entity;
 				for (auto it = entities.begin(); it != entities.end(); ++it) {
                     entity = *it;
 
-                    if (entity->isDestroyed || entity->parent != this) {
-                        entities.erase(it--);
+                    if (isChildRemoved(entity)) {
+                        childrenRemoved = true;
                         continue;
                     }
 					if (!entity->isVisible) continue;
 
-					properties->scrollX = recScrollX;
-					properties->scrollY = recScrollY;
-					properties->offsetX = recOffsetX;
-					properties->offsetY = recOffsetY;
-					properties->zoomX = recZoomX;
-					properties->zoomY = recZoomY;
-					properties->zoomFactorX = recZoomFactorX;
-					properties->zoomFactorY = recZoomFactorY;
-					properties->angle = recAngle;
-					properties->alpha = recAlpha;
 					entity->draw(vx, vy, vw, vh);
                 }
+				if (childrenRemoved) compactEntities();
+			}
+
+			/*
+			 * Works out the world transform the children are drawn under, once per frame at most.
+			 * Skipped when neither this entity's fields nor its parent's world transform changed.
+			 * Containers don't call this, their children start again from the view they set.
+			 */
+			void updateWorldTransform() {
+				if (properties->transforms == nullptr) return;
+				int slot = getTransformSlot();
+				int parentSlot = getParentTransformSlot();
+
+				Amara::WorldTransform own;
+				own.offsetX = getInterpolatedX();
+				own.offsetY = getInterpolatedY();
+				own.zoomX = scaleX;
+				own.zoomY = scaleY;
+				own.scrollFactorX = scrollFactorX;
+				own.scrollFactorY = scrollFactorY;
+				own.zoomFactorX = zoomFactorX;
+				own.zoomFactorY = zoomFactorY;
+				own.angle = angle;
+				own.alpha = alpha;
+				properties->transforms->update(slot, parentSlot, own);
+			}
+
+			int getTransformSlot() {
+				if (transformSlot < 0 && properties && properties->transforms) {
+					transformSlot = properties->transforms->acquire();
+				}
+				return transformSlot;
+			}
+
+			// Slot of the world transform this entity is drawn under, its parent's unless it's drawn in its parent's place.
+			virtual int getParentTransformSlot() {
+				return (parent) ? parent->getTransformSlot() : -1;
+			}
+
+			// What this entity is drawn with, the current view applied to its parent's world transform.
+			Amara::Transform getDrawTransform() {
+				int parentSlot = getParentTransformSlot();
+				if (parentSlot < 0) return properties->view;
+				return properties->view.apply(properties->transforms->world[parentSlot]);
 			}
 
 			virtual void run() {
@@ -453,13 +709,58 @@ namespace Amara {
                     }
 				}
 
+				if (depthFollowsY) depth = y + depthOffsetY;
+
 				for (Amara::Entity* entity : entities) {
 					if (entity->isDestroyed || entity->parent != this) continue;
+					entity->recordPreviousPosition();
 					entity->run();
 				}
 			}
 
+			void recordPreviousPosition() {
+				previousX = x;
+				previousY = y;
+				previousZ = z;
+				hasPreviousPosition = true;
+			}
+
+			// Call after teleporting an entity so it doesn't get drawn sliding to its new position.
+			void resetInterpolation() {
+				hasPreviousPosition = false;
+			}
+
+			// Whether the interpolated position still changes between ticks.
+			virtual bool isInterpolating() {
+				return hasPreviousPosition && (x != previousX || y != previousY || z != previousZ);
+			}
+
+			void markBoundsChanged() {
+				spatialEntry.boundsChanged = true;
+			}
+
+			float getInterpolatedX() {
+				if (!hasPreviousPosition) return x;
+				return previousX + (x - previousX) * properties->interpolation;
+			}
+			float getInterpolatedY() {
+				if (!hasPreviousPosition) return y;
+				return previousY + (y - previousY) * properties->interpolation;
+			}
+			float getInterpolatedZ() {
+				if (!hasPreviousPosition) return z;
+				return previousZ + (z - previousZ) * properties->interpolation;
+			}
+
+			// Ids assigned straight to id aren't indexed, so a miss in the index still scans the children.
 			virtual Amara::Entity* get(std::string find) {
+				if (entityIndex) {
+					for (Amara::Entity* entity: entityIndex->getById(Amara::hashString(find))) {
+						if (entity->parent == this && entity->id.compare(find) == 0) {
+							return entity;
+						}
+					}
+				}
 				for (Amara::Entity* entity : entities) {
 					if (entity->id.compare(find) == 0) {
 						return entity;
@@ -474,28 +775,48 @@ namespace Amara {
 				return entity;
 			}
 
+			template <class T, class... Args>
+			T* addNew(Args&&... args) {
+				T* entity = new (arena) T(std::forward<Args>(args)...);
+				add(entity);
+				return entity;
+			}
+
 			virtual Amara::Entity* remove(size_t index) {
 				Amara::Entity* child = entities.at(index);
 				child->parent = nullptr;
+				child->setEntityIndex(nullptr);
 				entities.erase(entities.begin() + index);
 				return child;
 			}
 
 			virtual Amara::Entity* remove(Amara::Entity* entity) {
-				Amara::Entity* child;
-				for (auto it = entities.begin(); it != entities.end(); ++it) {
-					child = *it;
-					if (child == entity) {
-						entities.erase(it--);
-					}
-				}
+				size_t removed = Amara::compact(entities, [entity](Amara::Entity* child) {
+					return child == entity;
+				});
+				if (removed > 0) entity->setEntityIndex(nullptr);
 				return nullptr;
 			}
 
 			virtual void removeEntities() {
+				for (Amara::Entity* child: entities) {
+					if (child->parent == this) child->setEntityIndex(nullptr);
+				}
 				entities.clear();
 			}
 
+			// Destroyed or re-parented children are skipped while iterating and compacted afterwards.
+			bool isChildRemoved(Amara::Entity* child) {
+				return child->isDestroyed || child->parent != this;
+			}
+
+			virtual void compactEntities() {
+				if (entities.empty()) return;
+				Amara::compact(entities, [this](Amara::Entity* child) {
+					return isChildRemoved(child);
+				});
+			}
+
 			virtual void addPhysics(Amara::PhysicsBase* gPhysics) {
 				physics = gPhysics;
 				physics->isActive = true;
@@ -505,6 +826,13 @@ namespace Amara {
 				physics->create();
 			}
 
+			template <class T, class... Args>
+			T* addNewPhysics(Args&&... args) {
+				T* body = new (arena) T(std::forward<Args>(args)...);
+				addPhysics(body);
+				return body;
+			}
+
 			virtual Amara::PhysicsBase* removePhysics() {
 				Amara::PhysicsBase* rec = physics;
 				if (physics) {
@@ -547,6 +875,8 @@ namespace Amara {
 
 			virtual void destroy(bool recursiveDestroy) {
 				if (isDestroyed) return;
+				setEntityIndex(nullptr);
+				Amara::Entity* formerParent = parent;
 				parent = nullptr;
 
 				destroyEntities(recursiveDestroy);
@@ -554,7 +884,14 @@ namespace Amara {
 				isDestroyed = true;
 				isActive = false;
 
-				properties->taskManager->queueDeletion(this);
+				if (tweens) tweens->cancel(this);
+				properties->taskManager->queueDeletion(this, formerParent);
+
+				if (pushedMessages || subscribed) {
+					properties->messages->forget(this);
+					pushedMessages = false;
+					subscribed = false;
+				}
 
 				if (physics) {
 					physics->destroy();
@@ -565,6 +902,21 @@ namespace Amara {
 				destroy(true);
 			}
 
+			// Called by the scene as the entity leaves or re-enters its activity regions.
+			virtual void setDormant(bool dormant) {
+				if (isDormant == dormant) return;
+				isDormant = dormant;
+				if (dormant) onSleep();
+				else {
+					// The position recorded when it fell asleep is stale, don't slide from it.
+					recordPreviousPosition();
+					onWake();
+				}
+			}
+
+			virtual void onSleep() {}
+			virtual void onWake() {}
+
 			void setVisible(bool val) {
 				isVisible = val;
 			}
@@ -608,16 +960,7 @@ namespace Amara {
 			}
 
 			void resetPassOnProperties() {
-				properties->zoomX = 1;
-                properties->zoomY = 1;
-                properties->zoomFactorX = 1;
-                properties->zoomFactorY = 1;
-                properties->angle = 0;
-                properties->offsetX = 0;
-                properties->offsetY = 0;
-                properties->scrollX = 0;
-                properties->scrollY = 0;
-				properties->alpha = 1;
+				properties->view.reset();
 			}
 
 			virtual void bringToFront() {
@@ -673,40 +1016,70 @@ namespace Amara {
 				setLoader(gLoader, true);
 			}
 
+			// What this entity broadcast since it last ran expires here.
 			void updateMessages() {
 				if (pushedMessages) {
-					pushedMessages = false;
-					Amara::MessageQueue& messages = *(properties->messages);
-					for (auto it = messages.begin(); it != messages.end(); ++it) {
-						Message msg = *it;
-						if (msg.parent == this) {
-							if (msg.skip) {
-								msg.skip = false;
-								pushedMessages = true;
-							}
-							else messages.queue.erase(it--);
-						}
-					}
+					pushedMessages = properties->messages->expireFrom(this);
 				}
 			}
 			Message& broadcastMessage(std::string key, nlohmann::json gData) {
 				pushedMessages = true;
 				return properties->messages->broadcast(this, key, gData);
 			}
+			Message& broadcastMessage(Amara::StringId channel) {
+				pushedMessages = true;
+				return properties->messages->publish(this, channel);
+			}
+			template <class T>
+			Message& broadcastMessage(Amara::StringId channel, const T& payload) {
+				pushedMessages = true;
+				return properties->messages->publish(this, channel, payload);
+			}
 			Message& getMessage(std::string key) {
 				return properties->messages->get(key);
 			}
+			Message& getMessage(Amara::StringId channel) {
+				return properties->messages->get(channel);
+			}
+
+			// The callback gets every message on the channel once, at the start of the tick after it was sent.
+			void subscribe(Amara::StringId channel, std::function<void(Amara::Message&)> callback) {
+				subscribed = true;
+				properties->messages->subscribe(channel, this, callback);
+			}
+			void subscribe(std::string channel, std::function<void(Amara::Message&)> callback) {
+				subscribe(Amara::hashString(channel), callback);
+			}
+			void unsubscribe(Amara::StringId channel) {
+				properties->messages->unsubscribe(channel, this);
+			}
+			void unsubscribe(std::string channel) {
+				unsubscribe(Amara::hashString(channel));
+			}
 			virtual void receiveMessages() {}
 
 			virtual void create() {}
 			virtual void update() {}
 
 			virtual ~Entity() {
-				if (physics != nullptr && physics->deleteWithParent) {
+				if (entityIndex) entityIndex->remove(this, indexedId, tags);
+				if (tweens) tweens->cancel(this);
+				// Cameras are deleted without destroy(), and arena slots get reused by new entities.
+				if (pushedMessages || subscribed) properties->messages->forget(this);
+				if (transformSlot >= 0) properties->transforms->release(transformSlot);
+				// Destroyed bodies are already queued for deletion.
+				if (physics != nullptr && physics->deleteWithParent && !physics->isDestroyed) {
 					delete physics;
 				}
 			}
 		protected:
+			static std::vector<Amara::Entity*> noEntities;
+
+			Amara::StringId toIndexedId(const std::string& gId) {
+				if (gId.empty()) return 0;
+				return Amara::StringIds::intern(gId);
+			}
 	};
+	std::vector<Amara::Entity*> Entity::noEntities;
 }
 #endif
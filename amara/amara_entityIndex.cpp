@@ -0,0 +1,125 @@
+#pragma once
+#ifndef AMARA_ENTITYINDEX
+#define AMARA_ENTITYINDEX
+
+#include "amara.h"
+
+namespace Amara {
+    class Entity;
+
+    // Unordered set of entities with constant time add, remove and contains, iterated through members.
+    class EntityGroup {
+        public:
+            std::vector<Amara::Entity*> members;
+            std::unordered_map<Amara::Entity*, size_t> slots;
+
+            bool add(Amara::Entity* entity) {
+                if (slots.find(entity) != slots.end()) return false;
+                slots[entity] = members.size();
+                members.push_back(entity);
+                return true;
+            }
+
+            bool remove(Amara::Entity* entity) {
+                auto got = slots.find(entity);
+                if (got == slots.end()) return false;
+                size_t slot = got->second;
+                slots.erase(got);
+                if (slot != members.size() - 1) {
+                    members[slot] = members.back();
+                    slots[members[slot]] = slot;
+                }
+                members.pop_back();
+                return true;
+            }
+
+            bool contains(Amara::Entity* entity) {
+                return slots.find(entity) != slots.end();
+            }
+
+            size_t size() {
+                return members.size();
+            }
+
+            bool empty() {
+                return members.empty();
+            }
+
+            void clear() {
+                members.clear();
+                slots.clear();
+            }
+    };
+
+    /*
+     * Every entity attached to a scene, grouped by hashed id and by tag.
+     * Entities keep it in sync themselves through init, setId, the tag methods, remove and destroy.
+     */
+    class EntityIndex {
+        public:
+            Amara::EntityGroup all;
+            std::unordered_map<Amara::StringId, Amara::EntityGroup> ids;
+            std::unordered_map<Amara::StringId, Amara::EntityGroup> tags;
+
+            void add(Amara::Entity* entity, Amara::StringId id, std::vector<Amara::StringId>& entityTags) {
+                if (!all.add(entity)) return;
+                if (id != 0) ids[id].add(entity);
+                for (Amara::StringId tag: entityTags) tags[tag].add(entity);
+            }
+
+            void remove(Amara::Entity* entity, Amara::StringId id, std::vector<Amara::StringId>& entityTags) {
+                if (!all.remove(entity)) return;
+                if (id != 0) removeFrom(ids, id, entity);
+                for (Amara::StringId tag: entityTags) removeFrom(tags, tag, entity);
+            }
+
+            void changeId(Amara::Entity* entity, Amara::StringId oldId, Amara::StringId newId) {
+                if (!all.contains(entity)) return;
+                if (oldId != 0) removeFrom(ids, oldId, entity);
+                if (newId != 0) ids[newId].add(entity);
+            }
+
+            void addTag(Amara::Entity* entity, Amara::StringId tag) {
+                if (!all.contains(entity)) return;
+                tags[tag].add(entity);
+            }
+
+            void removeTag(Amara::Entity* entity, Amara::StringId tag) {
+                removeFrom(tags, tag, entity);
+            }
+
+            std::vector<Amara::Entity*>& getById(Amara::StringId id) {
+                auto got = ids.find(id);
+                if (got == ids.end()) return emptyList;
+                return got->second.members;
+            }
+
+            std::vector<Amara::Entity*>& getTagged(Amara::StringId tag) {
+                auto got = tags.find(tag);
+                if (got == tags.end()) return emptyList;
+                return got->second.members;
+            }
+
+            bool isTagged(Amara::Entity* entity, Amara::StringId tag) {
+                auto got = tags.find(tag);
+                if (got == tags.end()) return false;
+                return got->second.contains(entity);
+            }
+
+            size_t numEntities() {
+                return all.size();
+            }
+
+        private:
+            std::vector<Amara::Entity*> emptyList;
+
+            void removeFrom(std::unordered_map<Amara::StringId, Amara::EntityGroup>& groups, Amara::StringId key, Amara::Entity* entity) {
+                auto got = groups.find(key);
+                if (got == groups.end()) return;
+                got->second.remove(entity);
+                if (got->second.empty()) groups.erase(got);
+            }
+    };
+}
+
+#endif
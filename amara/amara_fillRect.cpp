@@ -103,13 +103,15 @@ namespace Amara {
 				viewport.y = vy;
 				viewport.w = vw;
 				viewport.h = vh;
+				Amara::SpriteBatch::flush(properties);
 				SDL_RenderSetViewport(properties->gRenderer, &viewport);
 
-				float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-				float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+				Amara::Transform transform = getDrawTransform();
+				float nzoomX = transform.getZoomX(zoomFactorX);
+				float nzoomY = transform.getZoomY(zoomFactorY);
 
-				destRect.x = ((x+renderOffsetX - properties->scrollX*scrollFactorX + properties->offsetX - (originX * width * scaleX)) * nzoomX);
-				destRect.y = ((y-z+renderOffsetY - properties->scrollY*scrollFactorY + properties->offsetY - (originY * height * scaleY)) * nzoomY);
+				destRect.x = ((transform.getScreenX(x+renderOffsetX, scrollFactorX) - (originX * width * scaleX)) * nzoomX);
+				destRect.y = ((transform.getScreenY(y-z+renderOffsetY, scrollFactorY) - (originY * height * scaleY)) * nzoomY);
 				destRect.w = ((width * scaleX) * nzoomX);
 				destRect.h = ((height * scaleY) * nzoomY);
 
@@ -154,7 +156,7 @@ namespace Amara {
 
 					checkForHover(hx, hy, hw, hh);
 					
-					int newAlpha = (float)color.a * alpha * properties->alpha;
+					int newAlpha = (float)color.a * alpha * transform.alpha;
 
 					SDL_GetRenderDrawColor(properties->gRenderer, &recColor.r, &recColor.g, &recColor.b, &recColor.a);
 
@@ -5,6 +5,50 @@
 #include "amara.h"
 
 namespace Amara {
+	void TaskManager::detachQueued() {
+		if (detachQueue.empty()) return;
+		std::sort(detachQueue.begin(), detachQueue.end());
+		detachQueue.erase(std::unique(detachQueue.begin(), detachQueue.end()), detachQueue.end());
+		for (Amara::Entity* formerParent: detachQueue) {
+			formerParent->compactEntities();
+		}
+		detachQueue.clear();
+	}
+
+	void TaskManager::run() {
+		// Nothing can reach a queued entity through its old parent once this is done.
+		detachQueued();
+
+		deletedLastFrame = 0;
+		if (getQueueDepth() == 0) return;
+
+		budgetEnd = SDL_GetPerformanceCounter() + (Uint64)(timeBudget * SDL_GetPerformanceFrequency() / 1000.0);
+
+		drain(entityDeletionQueue, entityIndex);
+		drain(physicsDeletionQueue, physicsIndex);
+		drain(transitionDeletionQueue, transitionIndex);
+		drain(objectDeletionQueue, objectIndex);
+
+		teardownSize += deletedLastFrame;
+		teardownFrames += 1;
+		if (getQueueDepth() == 0) {
+			if (properties->testing) {
+				std::cout << "TaskManager: Deleted " << teardownSize << " objects over " << teardownFrames << " frame(s)." << std::endl;
+			}
+			teardownFrames = 0;
+			teardownSize = 0;
+		}
+	}
+
+	void TaskManager::flush() {
+		detachQueued();
+		double recTimeBudget = timeBudget;
+		int recCountBudget = countBudget;
+		removeBudget();
+		run();
+		setBudget(recTimeBudget, recCountBudget);
+	}
+
 	class Game {
 		public:
 			SDL_version compiledVersion;
@@ -16,7 +60,8 @@ namespace Amara {
 			std::unordered_map<std::string, void*> globalObjects;
 			RNG rng;
 
-			Amara::MessageQueue messages = MessageQueue();
+			Amara::MessageBus messages = MessageBus();
+			Amara::TransformStore transforms;
 
 			std::string name;
 			bool quit = false;
@@ -58,22 +103,39 @@ namespace Amara {
 
 			Amara::FileWriter* writer = nullptr;
 
+			Amara::Profiler* profiler = nullptr;
+
+			Amara::InputRecorder* recorder = nullptr;
+			bool quitAfterReplay = false;
+
 			bool vsync = false;
 			int fps = 60;
-			int tps = 1000 / fps;
 			int lps = fps;
 			int realFPS = fps;
-			LTimer fpsTimer;
-			LTimer capTimer;
 
-			int frameCounter = 0;
-			int logicDelay = 0;
+			// Fixed timestep, logic runs at lps while drawing runs at fps.
+			Uint64 perfFrequency = 0;
+			Uint64 frameStartCounter = 0;
+			Uint64 lastLogicCounter = 0;
+			double logicAccumulator = 0;
+			int maxCatchUpSteps = 5;
+
+			// How far between the last two logic ticks the current frame is drawn.
+			bool interpolationEnabled = true;
+			float interpolation = 1;
 
 			SDL_Event e;
 
 			bool testing = true;
 			bool hardwareRendering = true;
 
+			// Headless games have no window or audio device, logic can run as fast as possible.
+			bool headless = false;
+			bool headlessRendering = false;
+			bool throttled = true;
+
+			Uint64 logicTicks = 0;
+
 			Game(std::string givenName, bool gRendering) {
 				name = givenName;
 
@@ -100,6 +162,16 @@ namespace Amara {
             	SDL_Log("Linking against SDL version %d.%d.%d.\n",
                 linkedVersion.major, linkedVersion.minor, linkedVersion.patch);
 
+				perfFrequency = SDL_GetPerformanceFrequency();
+				lastLogicCounter = 0;
+				logicAccumulator = 0;
+
+				if (headless) {
+					SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+					SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+					hardwareRendering = false;
+				}
+
 				// Creating the video context
 				if (SDL_Init(SDL_INIT_VIDEO) < 0) {
 					SDL_Log("Game Error: Failed to initialize Video.");
@@ -122,27 +194,44 @@ namespace Amara {
 					SDL_Log("Game Error: Failed to initialize Game Controller.");
 				}
 
-				// Creating the window
-				gWindow = SDL_CreateWindow(this->name.c_str(), SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, width, height, SDL_WINDOW_SHOWN);
-				if (gWindow == NULL) {
-					SDL_Log("Window could not be created. Game Error: %s\n", SDL_GetError());
-					return false;
+				if (headless) {
+					// Offscreen surface with a software renderer in place of a window
+					gWindow = NULL;
+					gSurface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA8888);
+					if (gSurface == NULL) {
+						SDL_Log("Headless surface could not be created. Game Error: %s\n", SDL_GetError());
+						return false;
+					}
+					properties->gWindow = gWindow;
+					properties->gSurface = gSurface;
 				}
-				properties->gWindow = gWindow;
+				else {
+					// Creating the window
+					gWindow = SDL_CreateWindow(this->name.c_str(), SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, width, height, SDL_WINDOW_SHOWN);
+					if (gWindow == NULL) {
+						SDL_Log("Window could not be created. Game Error: %s\n", SDL_GetError());
+						return false;
+					}
+					properties->gWindow = gWindow;
 
-				// Get window surface
-				gSurface = SDL_GetWindowSurface(gWindow);
-				properties->gSurface = gSurface;
+					// Get window surface
+					gSurface = SDL_GetWindowSurface(gWindow);
+					properties->gSurface = gSurface;
 
-				// Fill the surface black
-				// Background color
-				SDL_FillRect(gSurface, NULL, SDL_MapRGB(gSurface->format, 0, 0, 0));
+					// Fill the surface black
+					// Background color
+					SDL_FillRect(gSurface, NULL, SDL_MapRGB(gSurface->format, 0, 0, 0));
 
-				//Update the surface
-				SDL_UpdateWindowSurface(gWindow);
+					//Update the surface
+					SDL_UpdateWindowSurface(gWindow);
+				}
 
 				// Setting up the Renderer
-				if (hardwareRendering) {
+				if (headless) {
+					gRenderer = SDL_CreateSoftwareRenderer(gSurface);
+					SDL_Log("Started Headless on Software Rendering.");
+				}
+				else if (hardwareRendering) {
 					gRenderer = SDL_CreateRenderer(gWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE);
 					SDL_Log("Started on Hardware Accelerated Rendering.");
 				}
@@ -155,6 +244,7 @@ namespace Amara {
 					return false;
 				}
 				properties->gRenderer = gRenderer;
+				properties->spriteBatch = new Amara::SpriteBatch(gRenderer);
 
 				// Initialize renderer color
 				SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 255);
@@ -175,11 +265,15 @@ namespace Amara {
 				//Initialize SDL_mixer
 				if(Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0 ) {
 					SDL_Log("Game Error: SDL_mixer could not initialize. SDL_mixer Error: %s\n", Mix_GetError());
-					return false;
+					if (!headless) return false;
 				}
 
 				SDL_DisplayMode dm;
-				if (SDL_GetCurrentDisplayMode(0, &dm) != 0) {
+				if (headless) {
+					dm.w = width;
+					dm.h = height;
+				}
+				else if (SDL_GetCurrentDisplayMode(0, &dm) != 0) {
 					SDL_Log("Game Error: Unable to detect display. Error: %s\n", SDL_GetError());
 					return false;
 				}
@@ -196,7 +290,7 @@ namespace Amara {
 				window = new Amara::IntRect{ 0, 0, width, height };
 				properties->window = window;
 
-				SDL_GetWindowPosition(gWindow, &window->x, &window->y);
+				if (gWindow != NULL) SDL_GetWindowPosition(gWindow, &window->x, &window->y);
 				// SDL_Log("Game Info: Display width: %d, Display height: %d\n", dm.w, dm.h);
 
 				load = new Amara::Loader(properties);
@@ -214,20 +308,22 @@ namespace Amara {
 
 				messages.clear();
 				properties->messages = &messages;
+				properties->transforms = &transforms;
 
 				writer = new FileWriter();
 
+				profiler = new Amara::Profiler();
+				properties->profiler = profiler;
+				Amara::Profiler::current = profiler;
+
 				globalData.clear();
 				rng.randomize();
 
 
+				recorder = new Amara::InputRecorder(properties);
+
 				// Check connected gamepads
-				for (int i = 0; i < SDL_NumJoysticks(); i++) {
-					if (SDL_IsGameController(i)) {
-						SDL_GameController* controller = SDL_GameControllerOpen(i);
-						input->gamepads->connectGamepad(controller);
-					}
-				}
+				connectGamepads();
 
 				controls = new Amara::ControlScheme(properties);
 				properties->controls = controls;
@@ -248,6 +344,18 @@ namespace Amara {
 				writeProperties();
 
 				setWindowSize(width, height);
+
+				return true;
+			}
+
+			bool initHeadless(int startWidth, int startHeight, bool gThrottled) {
+				headless = true;
+				throttled = gThrottled;
+				return init(startWidth, startHeight);
+			}
+
+			bool initHeadless(int startWidth, int startHeight) {
+				return initHeadless(startWidth, startHeight, false);
 			}
 
 			// For when the player closes the game
@@ -261,8 +369,17 @@ namespace Amara {
 				TTF_Quit();
 				IMG_Quit();
 
+				if (properties->spriteBatch) {
+					delete properties->spriteBatch;
+					properties->spriteBatch = nullptr;
+				}
 				SDL_DestroyRenderer(gRenderer);
-				SDL_DestroyWindow(gWindow);
+				if (gWindow != NULL) {
+					SDL_DestroyWindow(gWindow);
+				}
+				else if (headless && gSurface != NULL) {
+					SDL_FreeSurface(gSurface);
+				}
 
 				SDL_Quit();
 			}
@@ -281,66 +398,134 @@ namespace Amara {
 				start();
 			}
 
+			// Runs a fixed number of logic ticks back to back, mostly for headless simulations.
+			void simulate(Uint64 numTicks) {
+				Uint64 targetTicks = logicTicks + numTicks;
+				while (!quit && logicTicks < targetTicks) {
+					gameLoop();
+				}
+			}
+
+			void connectGamepads() {
+				for (int i = 0; i < SDL_NumJoysticks(); i++) {
+					if (SDL_IsGameController(i)) {
+						SDL_GameController* controller = SDL_GameControllerOpen(i);
+						input->gamepads->connectGamepad(controller);
+					}
+				}
+			}
+
+			/*
+			 * Records all input from the next logic tick onwards.
+			 * The game's rng is reseeded so the replay can reproduce anything drawn from it.
+			 */
+			void startRecording(Uint32 seed) {
+				if (recorder->replaying) stopReplay();
+				rng.seed(seed);
+				recorder->startRecording(seed, logicTicks);
+
+				// Gamepads connected before recording would otherwise be missing from the replay.
+				Amara::InputRecord rec;
+				rec.type = INPUT_GAMEPADCONNECT;
+				for (Amara::Gamepad* gamepad: input->gamepads->gamepads) {
+					if (gamepad->isAvailable()) {
+						rec.index = gamepad->index;
+						recorder->record(rec, logicTicks);
+					}
+				}
+			}
+
+			void startRecording() {
+				startRecording(time(0));
+			}
+
+			bool stopRecording(std::string path) {
+				if (!recorder->recording) return false;
+				recorder->stopRecording(logicTicks);
+				return recorder->save(path);
+			}
+
+			/*
+			 * Replays a recording from the next logic tick, live input is ignored until it ends.
+			 * Start it from the same state the recording was started from.
+			 */
+			bool startReplay(std::string path, bool gQuitAfterReplay) {
+				if (recorder->recording) recorder->stopRecording(logicTicks);
+				if (!recorder->load(path)) return false;
+				quitAfterReplay = gQuitAfterReplay;
+
+				input->gamepads->disconnectAll();
+				rng.seed(recorder->seed);
+				recorder->startReplay(logicTicks);
+				return true;
+			}
+
+			bool startReplay(std::string path) {
+				return startReplay(path, false);
+			}
+
+			void stopReplay() {
+				if (!recorder->replaying && !recorder->replayFinished) return;
+				recorder->stopReplay();
+				recorder->replayFinished = false;
+
+				input->gamepads->disconnectAll();
+				connectGamepads();
+			}
+
+			bool isRecording() {
+				return recorder->recording;
+			}
+
+			bool isReplaying() {
+				return recorder->replaying;
+			}
+
+			void setThrottled(bool gThrottled) {
+				throttled = gThrottled;
+			}
+
+			void setHeadlessRendering(bool enabled) {
+				headlessRendering = enabled;
+			}
+
 			void gameLoop() {
 				renderTargetsReset = false;
 				renderDeviceReset = false;
 				
 				manageFPSStart();
+				profiler->beginFrame();
 
 				writeProperties();
 
+				if (headless && !throttled) {
+					// One tick per loop, as fast as it can go
+					update();
+					interpolation = 1;
+					properties->interpolation = interpolation;
+				}
+				else {
+					// Run as many fixed logic ticks as the elapsed time calls for
+					manageLogic();
+				}
+
 				// Draw Screen
-				draw();
+				if (!headless || headlessRendering) {
+					draw();
+				}
+
+				// Headless frames skip draw(), so regions are pruned here as well.
+				scenes->pruneActivityRegions();
+				{
+					AMARA_PROFILE_SCOPE("taskManager");
+					taskManager->run();
+				}
+				profiler->endFrame();
 
 				// Manage frame catch up and slow down
-				manageFPSEnd();
-
-				deleteEntities();
-				deleteObjects();
-				deleteTransitions();
-				taskManager->run();
-			}
-
-			void deleteEntities() {
-				std::vector<Amara::Entity*>& deleteQueue = taskManager->getEntityQueue();
-				Amara::Entity* obj;
-                int size = deleteQueue.size();
-                if (testing && size > 0) {
-                    std::cout << "TaskManager: Deleting " << size << " entities." << std::endl;
-                }
-                for (size_t i = 0; i < size; i++) {
-                    obj = deleteQueue.at(i);
-                    delete obj;
-                }
-                deleteQueue.clear();
-			}
-
-			void deleteObjects() {
-				std::vector<void*>& deleteQueue = taskManager->getObjectQueue();
-				void* obj;
-                int size = deleteQueue.size();
-                if (testing && size > 0) {
-                    std::cout << "TaskManager: Deleting " << size << " objects." << std::endl;
-                }
-                for (size_t i = 0; i < size; i++) {
-                    obj = deleteQueue.at(i);
-                    delete obj;
-                }
-                deleteQueue.clear();
-			}
-
-			void deleteTransitions() {
-				std::vector<Amara::SceneTransitionBase*>& deleteQueue = taskManager->getTransitionQueue();
-				Amara::SceneTransitionBase* obj;
-                int size = deleteQueue.size();
-                if (testing && size > 0) {
-                    std::cout << "TaskManager: Deleting " << size << " transitions." << std::endl;
-                }
-                for (size_t i = 0; i < size; i++) {
-                    obj = deleteQueue.at(i);
-                    delete obj;
-                }
-                deleteQueue.clear();
+				if (!headless || throttled) {
+					manageFPSEnd();
+				}
 			}
 
 			void addGlobalObject(std::string gKey, void* gObj) {
@@ -372,7 +557,6 @@ namespace Amara {
 			void setFPS(int newFps, bool lockLogicSpeed) {
 				fps = newFps;
 				properties->fps = fps;
-				tps = 1000 / fps;
 				if (!lockLogicSpeed) {
 					lps = newFps;
 					properties->lps = lps;
@@ -386,13 +570,21 @@ namespace Amara {
 			void setFPS(int newFps, int newLps) {
 				fps = newFps;
 				lps = newLps;
-				tps = 1000 / fps;
 				properties->fps = fps;
 				properties->lps = lps;
 			}
 
 			void setLogicTickRate(int newRate) {
 				lps = newRate;
+				properties->lps = lps;
+			}
+
+			void setMaxCatchUpSteps(int steps) {
+				maxCatchUpSteps = steps;
+			}
+
+			void setInterpolation(bool enabled) {
+				interpolationEnabled = enabled;
 			}
 
 			void setBackgroundColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
@@ -459,6 +651,8 @@ namespace Amara {
 				properties->gRenderer = gRenderer;
 
 				properties->testing = testing;
+				properties->headless = headless;
+				properties->logicTicks = logicTicks;
 
 				properties->width = width;
 				properties->height = height;
@@ -474,72 +668,128 @@ namespace Amara {
 				properties->fps = fps;
 				properties->lps = lps;
 				properties->realFPS = realFPS;
+				properties->interpolation = interpolation;
 
 				properties->backgroundColor = backgroundColor;
 			}
 
 			void update() {
 				if (quit) return;
-				handleEvents();
+				AMARA_PROFILE_SCOPE("update");
+				{
+					AMARA_PROFILE_SCOPE("handleEvents");
+					handleEvents();
+				}
 				writeProperties();
 				if (quit) return;
-				messages.update();
-				events->manage();
-				scenes->run();
-				scenes->manageTasks();
-				audio->run(1);
+				{
+					AMARA_PROFILE_SCOPE("messages");
+					messages.update();
+				}
+				{
+					AMARA_PROFILE_SCOPE("events");
+					events->manage();
+				}
+				{
+					AMARA_PROFILE_SCOPE("scenes.run");
+					scenes->run();
+				}
+				{
+					AMARA_PROFILE_SCOPE("scenes.manageTasks");
+					scenes->manageTasks();
+				}
+				{
+					AMARA_PROFILE_SCOPE("audio");
+					audio->run(1);
+				}
+
+				logicTicks += 1;
+				properties->logicTicks = logicTicks;
 			}
 
 			void draw() {
 				// Clear the Renderer
 				SDL_SetRenderDrawColor(gRenderer, backgroundColor.r, backgroundColor.g, backgroundColor.b, backgroundColor.a);
 				SDL_RenderClear(gRenderer);
+				properties->spriteBatch->resetStats();
 
-				if (frameCounter >= logicDelay) {
-					update();
-					frameCounter = 0;
+				{
+					AMARA_PROFILE_SCOPE("scenes.draw");
+					scenes->draw();
+					properties->spriteBatch->flush();
 				}
-				frameCounter += 1;
-
-				scenes->draw();
 
 				/// Draw to renderer
+				AMARA_PROFILE_SCOPE("present");
 				SDL_RenderPresent(gRenderer);
-				if (!hardwareRendering) {
+				if (!hardwareRendering && gWindow != NULL) {
 					SDL_UpdateWindowSurface(gWindow);
 				}
 			}
 
 			void manageFPSStart() {
-				capTimer.start();
+				Uint64 now = SDL_GetPerformanceCounter();
+				if (frameStartCounter != 0 && now > frameStartCounter) {
+					realFPS = round(perfFrequency / (double)(now - frameStartCounter));
+				}
+				frameStartCounter = now;
 			}
 
-			void manageFPSEnd() {
-				// Check if frame finished early
+			void manageLogic() {
 				if (quit) return;
-				int totalWait = 0;
-				logicDelay = 0;
-				lagging = false;
+				double logicStep = 1.0 / lps;
+				Uint64 now = SDL_GetPerformanceCounter();
 
-				if (fps < lps) {
-					for (int i = 1; i < lps/fps; i++) {
-						update();
-					}
+				if (lastLogicCounter == 0) {
+					// The first frame always gets one tick to start the scenes.
+					logicAccumulator = logicStep;
 				}
-				else if (fps > lps) {
-					logicDelay = fps/lps;
+				else {
+					logicAccumulator += (now - lastLogicCounter) / (double)perfFrequency;
 				}
+				lastLogicCounter = now;
 
-				int frameTicks = capTimer.getTicks();
-				if (frameTicks < tps) {
-					// Wait remaining time
-					totalWait += (tps - frameTicks);
+				lagging = false;
+				int steps = 0;
+				while (logicAccumulator >= logicStep) {
+					if (steps >= maxCatchUpSteps) {
+						// Too far behind, drop the backlog instead of spiralling.
+						logicAccumulator = fmod(logicAccumulator, logicStep);
+						lagging = true;
+						lagCounter += 1;
+						break;
+					}
+					update();
+					if (quit) return;
+					logicAccumulator -= logicStep;
+					steps += 1;
+				}
+
+				if (interpolationEnabled) {
+					interpolation = logicAccumulator / logicStep;
+					if (interpolation < 0) interpolation = 0;
+					if (interpolation > 1) interpolation = 1;
 				}
-				realFPS = fps / (frameTicks / 1000.f);
+				else {
+					interpolation = 1;
+				}
+				properties->interpolation = interpolation;
+				properties->lagging = lagging;
+			}
 
-				// Delay if game has not caught up
-				if (totalWait > 0) {
-					SDL_Delay(totalWait);
+			void manageFPSEnd() {
+				// Check if frame finished early
+				if (quit) return;
+				double frameTime = 1.0 / fps;
+				double elapsed = (SDL_GetPerformanceCounter() - frameStartCounter) / (double)perfFrequency;
+
+				// SDL_Delay is only millisecond accurate, sleep most of the wait and spin the rest.
+				double remaining = frameTime - elapsed;
+				if (remaining > 0.002) {
+					SDL_Delay((Uint32)((remaining - 0.001) * 1000));
+				}
+				while (elapsed < frameTime) {
+					elapsed = (SDL_GetPerformanceCounter() - frameStartCounter) / (double)perfFrequency;
 				}
 			}
 
@@ -552,80 +802,11 @@ namespace Amara {
 
 				// manageControllers();
 
-				while (SDL_PollEvent(&e) != 0) {
-					if (e.type == SDL_QUIT) {
-						quit = true;
-						properties->quit = true;
-					}
-					else if (e.type == SDL_KEYDOWN) {
-						input->keyboard->press(e.key.keysym.sym);
-						input->keyboard->isActivated = true;
-					}
-					else if (e.type == SDL_KEYUP) {
-						input->keyboard->release(e.key.keysym.sym);
-						input->keyboard->isActivated = true;
-					}
-					else if (e.type == SDL_MOUSEMOTION || e.type == SDL_MOUSEBUTTONDOWN || e.type == SDL_MOUSEBUTTONUP) {
-						int mx, my;
-						SDL_GetMouseState(&mx, &my);
-						input->mouse->dx = (mx * (float)resolution->width/(float)window->width);
-						input->mouse->dy = (my * (float)resolution->height/(float)window->height);
-
-						input->mouse->x = input->mouse->dx;
-						input->mouse->y = input->mouse->dy;
+				bool replaying = recorder->replaying;
+				Amara::InputRecord rec;
 
-						float offset, upScale;
-						int vx, vy = 0;
-						float ratioRes = ((float)properties->resolution->width / (float)properties->resolution->height);
-						float ratioWin = ((float)properties->window->width / (float)properties->window->height);
-
-						input->mouse->isActivated = true;
-						if (e.type == SDL_MOUSEMOTION) input->mouse->moved = true;
-
-						if (ratioRes < ratioWin) {
-							upScale = ((float)properties->window->height/(float)properties->resolution->height);
-							offset = ((float)properties->window->width - ((float)properties->resolution->width * upScale))/2;
-							input->mouse->dx = mx/upScale;
-							input->mouse->x = (mx - offset)/upScale;
-						}
-						else if (ratioRes > ratioWin) {
-							upScale = ((float)properties->window->width/(float)properties->resolution->width);
-							offset = ((float)properties->window->height - ((float)properties->resolution->height * upScale))/2;
-							input->mouse->dy = my/upScale;
-							input->mouse->y = (my - offset)/upScale;
-						}
-
-						if (e.type == SDL_MOUSEBUTTONDOWN) {
-							if (e.button.button == SDL_BUTTON_LEFT) {
-								input->mouse->left->press();
-							}
-							else if (e.button.button == SDL_BUTTON_RIGHT) {
-								input->mouse->right->press();
-							}
-							else if (e.button.button == SDL_BUTTON_MIDDLE) {
-								input->mouse->middle->press();
-							}
-						}
-						else if (e.type == SDL_MOUSEBUTTONUP) {
-							if (e.button.button == SDL_BUTTON_LEFT) {
-								input->mouse->left->release();
-							}
-							else if (e.button.button == SDL_BUTTON_RIGHT) {
-								input->mouse->right->release();
-							}
-							else if (e.button.button == SDL_BUTTON_MIDDLE) {
-								input->mouse->middle->release();
-							}
-						}
-					}
-					else if (e.type == SDL_MOUSEWHEEL) {
-						int mul = (e.wheel.direction == SDL_MOUSEWHEEL_FLIPPED) ? -1 : 1;
-						input->mouse->scrollX = e.wheel.x * mul;
-						input->mouse->scrollY = e.wheel.y * mul;
-
-						input->mouse->isActivated = true;
-					}
-					else if (e.type == SDL_WINDOWEVENT && (e.window.event == SDL_WINDOWEVENT_MOVED)) {
+				while (SDL_PollEvent(&e) != 0) {
+					if (e.type == SDL_WINDOWEVENT && (e.window.event == SDL_WINDOWEVENT_MOVED)) {
 						dragged = true;
 						properties->dragged = true;
 					}
@@ -645,59 +826,28 @@ namespace Amara {
 						renderDeviceReset = true;
 						load->regenerateAssets();
 					}
-					else if (e.type == SDL_CONTROLLERDEVICEADDED) {
-						SDL_GameController* controller = SDL_GameControllerOpen(e.cdevice.which);
-						input->gamepads->connectGamepad(controller);
-					}
-					else if (e.type == SDL_CONTROLLERDEVICEREMOVED) {
-						SDL_GameController* controller = SDL_GameControllerFromInstanceID(e.cbutton.which);
-						input->gamepads->disconnectGamepad(controller);
-					}
-					else if (e.type == SDL_CONTROLLERBUTTONDOWN) {
-						SDL_GameController* controller = SDL_GameControllerFromInstanceID(e.cbutton.which);
-						Amara::Gamepad* gamepad = input->gamepads->get(controller);
-						if (gamepad != nullptr) gamepad->press(e.cbutton.button);
-						input->gamepads->isActivated = true;
-					}
-					else if (e.type == SDL_CONTROLLERBUTTONUP) {
-						SDL_GameController* controller = SDL_GameControllerFromInstanceID(e.cbutton.which);
-						Amara::Gamepad* gamepad = input->gamepads->get(controller);
-						if (gamepad != nullptr) gamepad->release(e.cbutton.button);
-						input->gamepads->isActivated = true;
+					else if (e.type == SDL_QUIT && replaying) {
+						// Closing the window still works while a replay is driving the input.
+						quit = true;
+						properties->quit = true;
 					}
-					else if (e.type == SDL_CONTROLLERAXISMOTION) {
-						SDL_GameController* controller = SDL_GameControllerFromInstanceID(e.caxis.which);
-						Amara::Gamepad* gamepad = input->gamepads->get(controller);
-						if (gamepad != nullptr) gamepad->push(e.caxis.axis, e.caxis.value);
-						input->gamepads->isActivated = true;
+					else if (!replaying && toInputRecord(e, rec)) {
+						recorder->record(rec, logicTicks);
+						applyInput(rec);
 					}
-					if (e.type == SDL_FINGERDOWN) {
-						Amara::TouchPointer* pointer = input->touches->newPointer(e.tfinger.fingerId);
-						if (pointer) {
-							pointer->press();
-							pointer->virtualizeXY(e);
-						}
+				}
 
-						input->touches->isActivated = true;
+				if (replaying) {
+					while (recorder->next(logicTicks, rec)) {
+						applyInput(rec);
 					}
-					else if (e.type == SDL_FINGERMOTION) {
-						Amara::TouchPointer* pointer = input->touches->getPointer(e.tfinger.fingerId);
-						if (pointer) {
-							pointer->virtualizeXY(e);
+					if (recorder->replayFinished) {
+						SDL_Log("Game Info: Replay finished after %d ticks.\n", recorder->length);
+						stopReplay();
+						if (quitAfterReplay) {
+							quit = true;
+							properties->quit = true;
 						}
-
-						input->touches->isActivated = true;
-					}
-					else if (e.type == SDL_FINGERUP) {
-						Amara::TouchPointer* pointer = input->touches->getPointer(e.tfinger.fingerId);
-						if (pointer) {
-							pointer->release();
-							pointer->virtualizeXY(e);
-
-							input->touches->removePointer(pointer->id);
-						}
-
-						input->touches->isActivated = true;
 					}
 				}
 
@@ -722,7 +872,214 @@ namespace Amara {
 					input->lastMode = InputMode_Touch;
 				}
 			}
+
+			// Converts an SDL input event into a record, returns false for anything that isn't input.
+			bool toInputRecord(SDL_Event& e, Amara::InputRecord& rec) {
+				rec = Amara::InputRecord();
+				Amara::Gamepad* gamepad = nullptr;
+				switch (e.type) {
+					case SDL_QUIT:
+						rec.type = INPUT_QUIT;
+						return true;
+					case SDL_KEYDOWN:
+					case SDL_KEYUP:
+						rec.type = (e.type == SDL_KEYDOWN) ? INPUT_KEYDOWN : INPUT_KEYUP;
+						rec.code = e.key.keysym.sym;
+						return true;
+					case SDL_MOUSEMOTION:
+						rec.type = INPUT_MOUSEMOTION;
+						rec.x = e.motion.x;
+						rec.y = e.motion.y;
+						return true;
+					case SDL_MOUSEBUTTONDOWN:
+					case SDL_MOUSEBUTTONUP:
+						rec.type = (e.type == SDL_MOUSEBUTTONDOWN) ? INPUT_MOUSEDOWN : INPUT_MOUSEUP;
+						rec.code = e.button.button;
+						rec.x = e.button.x;
+						rec.y = e.button.y;
+						return true;
+					case SDL_MOUSEWHEEL: {
+						int mul = (e.wheel.direction == SDL_MOUSEWHEEL_FLIPPED) ? -1 : 1;
+						rec.type = INPUT_MOUSEWHEEL;
+						rec.x = e.wheel.x * mul;
+						rec.y = e.wheel.y * mul;
+						return true;
+					}
+					case SDL_CONTROLLERDEVICEADDED: {
+						SDL_GameController* controller = SDL_GameControllerOpen(e.cdevice.which);
+						input->gamepads->connectGamepad(controller);
+						gamepad = input->gamepads->get(controller);
+						if (gamepad == nullptr) return false;
+						rec.type = INPUT_GAMEPADCONNECT;
+						rec.index = gamepad->index;
+						return true;
+					}
+					case SDL_CONTROLLERDEVICEREMOVED: {
+						SDL_GameController* controller = SDL_GameControllerFromInstanceID(e.cdevice.which);
+						gamepad = input->gamepads->get(controller);
+						if (gamepad == nullptr) return false;
+						rec.type = INPUT_GAMEPADDISCONNECT;
+						rec.index = gamepad->index;
+						return true;
+					}
+					case SDL_CONTROLLERBUTTONDOWN:
+					case SDL_CONTROLLERBUTTONUP:
+						gamepad = input->gamepads->get(SDL_GameControllerFromInstanceID(e.cbutton.which));
+						if (gamepad == nullptr) return false;
+						rec.type = (e.type == SDL_CONTROLLERBUTTONDOWN) ? INPUT_GAMEPADDOWN : INPUT_GAMEPADUP;
+						rec.index = gamepad->index;
+						rec.code = e.cbutton.button;
+						return true;
+					case SDL_CONTROLLERAXISMOTION:
+						gamepad = input->gamepads->get(SDL_GameControllerFromInstanceID(e.caxis.which));
+						if (gamepad == nullptr) return false;
+						rec.type = INPUT_GAMEPADAXIS;
+						rec.index = gamepad->index;
+						rec.code = e.caxis.axis;
+						rec.x = e.caxis.value;
+						return true;
+					case SDL_FINGERDOWN:
+					case SDL_FINGERMOTION:
+					case SDL_FINGERUP:
+						if (e.type == SDL_FINGERDOWN) rec.type = INPUT_FINGERDOWN;
+						else if (e.type == SDL_FINGERMOTION) rec.type = INPUT_FINGERMOTION;
+						else rec.type = INPUT_FINGERUP;
+						rec.fingerId = e.tfinger.fingerId;
+						rec.fx = e.tfinger.x;
+						rec.fy = e.tfinger.y;
+						return true;
+				}
+				return false;
+			}
+
+			// Applies one input to the input managers, live and replayed input both go through here.
+			void applyInput(Amara::InputRecord& rec) {
+				Amara::Gamepad* gamepad = nullptr;
+				Amara::TouchPointer* pointer = nullptr;
+				switch (rec.type) {
+					case INPUT_QUIT:
+						quit = true;
+						properties->quit = true;
+						break;
+					case INPUT_KEYDOWN:
+						input->keyboard->press(rec.code);
+						input->keyboard->isActivated = true;
+						break;
+					case INPUT_KEYUP:
+						input->keyboard->release(rec.code);
+						input->keyboard->isActivated = true;
+						break;
+					case INPUT_MOUSEMOTION:
+					case INPUT_MOUSEDOWN:
+					case INPUT_MOUSEUP:
+						applyMousePosition(rec.x, rec.y);
+						input->mouse->isActivated = true;
+						if (rec.type == INPUT_MOUSEMOTION) input->mouse->moved = true;
+
+						if (rec.type == INPUT_MOUSEDOWN) {
+							if (rec.code == SDL_BUTTON_LEFT) {
+								input->mouse->left->press();
+							}
+							else if (rec.code == SDL_BUTTON_RIGHT) {
+								input->mouse->right->press();
+							}
+							else if (rec.code == SDL_BUTTON_MIDDLE) {
+								input->mouse->middle->press();
+							}
+						}
+						else if (rec.type == INPUT_MOUSEUP) {
+							if (rec.code == SDL_BUTTON_LEFT) {
+								input->mouse->left->release();
+							}
+							else if (rec.code == SDL_BUTTON_RIGHT) {
+								input->mouse->right->release();
+							}
+							else if (rec.code == SDL_BUTTON_MIDDLE) {
+								input->mouse->middle->release();
+							}
+						}
+						break;
+					case INPUT_MOUSEWHEEL:
+						input->mouse->scrollX = rec.x;
+						input->mouse->scrollY = rec.y;
+						input->mouse->isActivated = true;
+						break;
+					case INPUT_GAMEPADCONNECT:
+						// Live gamepads are connected while converting the event.
+						if (recorder->replaying) input->gamepads->connectVirtualGamepad(rec.index);
+						break;
+					case INPUT_GAMEPADDISCONNECT:
+						input->gamepads->disconnectGamepad((int)rec.index);
+						break;
+					case INPUT_GAMEPADDOWN:
+						gamepad = input->gamepads->get((int)rec.index);
+						if (gamepad != nullptr) gamepad->press(rec.code);
+						input->gamepads->isActivated = true;
+						break;
+					case INPUT_GAMEPADUP:
+						gamepad = input->gamepads->get((int)rec.index);
+						if (gamepad != nullptr) gamepad->release(rec.code);
+						input->gamepads->isActivated = true;
+						break;
+					case INPUT_GAMEPADAXIS:
+						gamepad = input->gamepads->get((int)rec.index);
+						if (gamepad != nullptr) gamepad->push(rec.code, rec.x);
+						input->gamepads->isActivated = true;
+						break;
+					case INPUT_FINGERDOWN:
+						pointer = input->touches->newPointer(rec.fingerId);
+						if (pointer) {
+							pointer->press();
+							pointer->virtualizeXY(rec.fx, rec.fy);
+						}
+						input->touches->isActivated = true;
+						break;
+					case INPUT_FINGERMOTION:
+						pointer = input->touches->getPointer(rec.fingerId);
+						if (pointer) {
+							pointer->virtualizeXY(rec.fx, rec.fy);
+						}
+						input->touches->isActivated = true;
+						break;
+					case INPUT_FINGERUP:
+						pointer = input->touches->getPointer(rec.fingerId);
+						if (pointer) {
+							pointer->release();
+							pointer->virtualizeXY(rec.fx, rec.fy);
+
+							input->touches->removePointer(pointer->id);
+						}
+						input->touches->isActivated = true;
+						break;
+				}
+			}
+
+			void applyMousePosition(int mx, int my) {
+				input->mouse->dx = (mx * (float)resolution->width/(float)window->width);
+				input->mouse->dy = (my * (float)resolution->height/(float)window->height);
+
+				input->mouse->x = input->mouse->dx;
+				input->mouse->y = input->mouse->dy;
+
+				float offset, upScale;
+				float ratioRes = ((float)properties->resolution->width / (float)properties->resolution->height);
+				float ratioWin = ((float)properties->window->width / (float)properties->window->height);
+
+				if (ratioRes < ratioWin) {
+					upScale = ((float)properties->window->height/(float)properties->resolution->height);
+					offset = ((float)properties->window->width - ((float)properties->resolution->width * upScale))/2;
+					input->mouse->dx = mx/upScale;
+					input->mouse->x = (mx - offset)/upScale;
+				}
+				else if (ratioRes > ratioWin) {
+					upScale = ((float)properties->window->width/(float)properties->resolution->width);
+					offset = ((float)properties->window->height - ((float)properties->resolution->height * upScale))/2;
+					input->mouse->dy = my/upScale;
+					input->mouse->y = (my - offset)/upScale;
+				}
+			}
 	};
+
 }
 
 #endif
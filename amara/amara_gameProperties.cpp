@@ -20,7 +20,9 @@ namespace Amara {
     class Music;
     class AudioGroup;
     class Assets;
-    class MessageQueue;
+    class MessageBus;
+    class Profiler;
+    class SpriteBatch;
 
     class GameProperties {
         public:
@@ -30,29 +32,20 @@ namespace Amara {
             SDL_Window* gWindow = NULL;
 			SDL_Surface* gSurface = NULL;
 			SDL_Renderer* gRenderer = NULL;
+            // Images queue their quads here, see SpriteBatch.
+            Amara::SpriteBatch* spriteBatch = nullptr;
 
             SDL_Color backgroundColor;
 
             bool testing = true;
+            bool headless = false;
 
             int width = 0;
             int height = 0;
 
-            float scrollX = 0;
-            float scrollY = 0;
-
-            float zoomFactorX = 1;
-            float zoomFactorY = 1;
-
-            float offsetX = 0;
-            float offsetY = 0;
-
-            float zoomX = 0;
-            float zoomY = 0;
-
-            float angle = 0;
-
-            float alpha = 1;
+            // Set once per camera, and by containers for their children. Entities apply it to their cached world transforms.
+            Amara::Transform view;
+            Amara::TransformStore* transforms = nullptr;
 
             Amara::IntRect* display = nullptr;
 			Amara::IntRect* resolution = nullptr;
@@ -70,6 +63,10 @@ namespace Amara {
             int fps = 60;
             int lps = fps;
             int realFPS = fps;
+            Uint64 logicTicks = 0;
+
+            // Fraction of the way between the previous and the current logic tick.
+            float interpolation = 1;
 
             Amara::Loader* loader = nullptr;
             Amara::AssetManager* assets = nullptr;
@@ -86,7 +83,9 @@ namespace Amara {
             Amara::EventManager* events = nullptr;
             Amara::AudioGroup* audio = nullptr;
 
-            Amara::MessageQueue* messages = nullptr;
+            Amara::MessageBus* messages = nullptr;
+
+            Amara::Profiler* profiler = nullptr;
 
             GameProperties() {}
     };
@@ -26,6 +26,7 @@ namespace Amara {
             std::unordered_map<Amara::Axiscode, Amara::Trigger*> triggers;
             
             bool isConnected = false;
+            bool isVirtual = false;
             bool justConnected = false;
             bool justDisconnected = false;
 
@@ -181,12 +182,26 @@ namespace Amara {
                 justConnected = true;
             }
 
+            // A gamepad with no device behind it, driven by replayed input.
+            void connectVirtual() {
+                controller = nullptr;
+                id = -1;
+                isVirtual = true;
+                isConnected = true;
+                justConnected = true;
+            }
+
             void disconnect() {
                 isConnected = false;
+                isVirtual = false;
                 justDisconnected = true;
                 controller = nullptr;
             }
 
+            bool isAvailable() {
+                return isConnected && (controller != nullptr || isVirtual);
+            }
+
             void manage() {
                 justConnected = false;
                 justDisconnected = false;
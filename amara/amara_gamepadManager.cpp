@@ -59,10 +59,38 @@ namespace Amara {
                 }
             }
 
+            void connectVirtualGamepad(int index) {
+                while (gamepads.size() <= index) {
+                    Amara::Gamepad* gamepad = new Amara::Gamepad();
+                    gamepad->index = gamepads.size();
+                    gamepads.push_back(gamepad);
+                }
+                Amara::Gamepad* gamepad = gamepads[index];
+                if (gamepad->isConnected) return;
+                gamepad->connectVirtual();
+                connected.push_back(gamepad);
+            }
+
+            void disconnectGamepad(int index) {
+                Amara::Gamepad* gamepad = get(index);
+                if (gamepad == nullptr || !gamepad->isConnected) return;
+                gamepad->disconnect();
+                disconnected.push_back(gamepad);
+            }
+
+            void disconnectAll() {
+                for (Amara::Gamepad* gamepad: gamepads) {
+                    if (gamepad->isConnected) {
+                        gamepad->disconnect();
+                        disconnected.push_back(gamepad);
+                    }
+                }
+            }
+
             int numConnected() {
                 int count = 0;
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         count += 1;
                     }
                 }
@@ -95,7 +123,7 @@ namespace Amara {
 
             bool isDown(Amara::Buttoncode bcode) {
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->isDown(bcode)) {
                             return true;
                         }
@@ -106,7 +134,7 @@ namespace Amara {
 
             bool justDown(Amara::Buttoncode bcode) {
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->justDown(bcode)) {
                             return true;
                         }
@@ -117,7 +145,7 @@ namespace Amara {
 
             bool justUp(Amara::Buttoncode bcode) {
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->justUp(bcode)) {
                             return true;
                         }
@@ -128,7 +156,7 @@ namespace Amara {
 
             bool tapped(Amara::Buttoncode bcode) {
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->tapped(bcode)) {
                             return true;
                         }
@@ -139,7 +167,7 @@ namespace Amara {
 
             bool held(Amara::Buttoncode bcode) {
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->held(bcode)) {
                             return true;
                         }
@@ -151,7 +179,7 @@ namespace Amara {
             int downTime(Amara::Buttoncode bcode) {
                 int t = 0;
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->downTime(bcode) > t) {
                             t = gamepad->downTime(bcode);
                         }
@@ -162,7 +190,7 @@ namespace Amara {
 
             bool activated(Amara::Buttoncode bcode) {
                 for (Amara::Gamepad* gamepad: gamepads) {
-                    if (gamepad->isConnected && gamepad->controller != nullptr) {
+                    if (gamepad->isAvailable()) {
                         if (gamepad->activated(bcode)) {
                             return true;
                         }
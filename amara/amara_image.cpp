@@ -152,10 +152,11 @@ namespace Amara {
                 viewport.y = vy;
                 viewport.w = vw;
                 viewport.h = vh;
-                SDL_RenderSetViewport(gRenderer, &viewport);
+                properties->spriteBatch->setViewport(viewport);
 
-                float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-                float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+                Amara::Transform transform = getDrawTransform();
+                float nzoomX = transform.getZoomX(zoomFactorX);
+                float nzoomY = transform.getZoomY(zoomFactorY);
 
                 bool scaleFlipHorizontal = false;
                 bool scaleFlipVertical = false;
@@ -171,8 +172,11 @@ namespace Amara {
                     scaleY = abs(scaleY);
                 }
 
-                float rotatedX = (x+renderOffsetX+cropLeft - properties->scrollX*scrollFactorX + properties->offsetX - (originX * imageWidth * scaleX));
-                float rotatedY = (y-z+renderOffsetY+cropTop - properties->scrollY*scrollFactorY + properties->offsetY - (originY * imageHeight * scaleY));
+                float drawX = getInterpolatedX();
+                float drawY = getInterpolatedY() - getInterpolatedZ();
+
+                float rotatedX = (transform.getScreenX(drawX+renderOffsetX+cropLeft, scrollFactorX) - (originX * imageWidth * scaleX));
+                float rotatedY = (transform.getScreenY(drawY+renderOffsetY+cropTop, scrollFactorY) - (originY * imageHeight * scaleY));
 
                 destRect.x = (rotatedX * nzoomX);
                 destRect.y = (rotatedY * nzoomY);
@@ -244,9 +248,8 @@ namespace Amara {
                                 srcRect.h = spr->frameHeight - cropTop - cropBottom;
                                 break;
                         }
-
-                        SDL_SetTextureBlendMode(tx, blendMode);
-				        SDL_SetTextureAlphaMod(tx, alpha * properties->alpha * 255);
+                        srcRect.x += texture->offsetX;
+                        srcRect.y += texture->offsetY;
 
                         SDL_RendererFlip flipVal = SDL_FLIP_NONE;
                         if (!flipHorizontal != !scaleFlipHorizontal) {
@@ -256,19 +259,34 @@ namespace Amara {
                             flipVal = (SDL_RendererFlip)(flipVal | SDL_FLIP_VERTICAL);
                         }
 
-                        SDL_RenderCopyExF(
-                            gRenderer,
-                            (SDL_Texture*)(texture->asset),
-                            &srcRect,
-                            &destRect,
-                            angle + properties->angle,
-                            &origin,
-                            flipVal
+                        properties->spriteBatch->draw(
+                            tx,
+                            blendMode,
+                            srcRect,
+                            destRect,
+                            angle + transform.angle,
+                            origin,
+                            flipVal,
+                            (Uint8)(alpha * transform.alpha * 255)
                         );
                     }
                 }
             }
 
+            virtual bool getDrawBounds(Amara::FloatRect& bounds) override {
+                if (texture == nullptr || !entities.empty()) return false;
+                if (scrollFactorX != 1 || scrollFactorY != 1 || zoomFactorX != 1 || zoomFactorY != 1) return false;
+
+                float absScaleX = fabs(scaleX);
+                float absScaleY = fabs(scaleY);
+                bounds.x = getInterpolatedX() + renderOffsetX + cropLeft - (originX * imageWidth * absScaleX);
+                bounds.y = getInterpolatedY() - getInterpolatedZ() + renderOffsetY + cropTop - (originY * imageHeight * absScaleY);
+                bounds.width = (imageWidth - cropLeft - cropRight) * absScaleX;
+                bounds.height = (imageHeight - cropTop - cropBottom) * absScaleY;
+                padBoundsForAngle(bounds, bounds.x + bounds.width*originX, bounds.y + bounds.height*originY);
+                return true;
+            }
+
             virtual void draw(int vx, int vy, int vw, int vh) override {
                 drawTexture(vx, vy, vw, vh);
 
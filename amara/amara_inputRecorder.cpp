@@ -0,0 +1,286 @@
+#pragma once
+#ifndef AMARA_INPUTRECORDER
+#define AMARA_INPUTRECORDER
+
+#include "amara.h"
+
+namespace Amara {
+    enum InputRecordType {
+        INPUT_NONE = 0,
+        INPUT_KEYDOWN,
+        INPUT_KEYUP,
+        INPUT_MOUSEMOTION,
+        INPUT_MOUSEDOWN,
+        INPUT_MOUSEUP,
+        INPUT_MOUSEWHEEL,
+        INPUT_GAMEPADCONNECT,
+        INPUT_GAMEPADDISCONNECT,
+        INPUT_GAMEPADDOWN,
+        INPUT_GAMEPADUP,
+        INPUT_GAMEPADAXIS,
+        INPUT_FINGERDOWN,
+        INPUT_FINGERMOTION,
+        INPUT_FINGERUP,
+        INPUT_QUIT
+    };
+
+    /*
+     * One input consumed by Game::handleEvents, stripped down to what the game actually reads.
+     * Gamepads are referred to by their index in the GamepadManager rather than SDL instance ids.
+     */
+    struct InputRecord {
+        Uint32 tick = 0;
+        Uint8 type = INPUT_NONE;
+        Uint8 index = 0;
+        Sint32 code = 0;
+        Sint32 x = 0;
+        Sint32 y = 0;
+        Sint64 fingerId = 0;
+        float fx = 0;
+        float fy = 0;
+    };
+
+    /*
+     * Keeps a log of inputs per logic tick along with the RNG seed they were recorded with.
+     * Replaying the log from the same starting state reproduces the session tick for tick.
+     */
+    class InputRecorder {
+        public:
+            Amara::GameProperties* properties = nullptr;
+
+            std::vector<Amara::InputRecord> records;
+
+            bool recording = false;
+            bool replaying = false;
+            bool replayFinished = false;
+
+            Uint32 seed = 0;
+            Uint32 length = 0;
+            Uint64 startTick = 0;
+            size_t replayIndex = 0;
+
+            InputRecorder(Amara::GameProperties* gameProperties) {
+                properties = gameProperties;
+            }
+
+            void startRecording(Uint32 gSeed, Uint64 tick) {
+                records.clear();
+                seed = gSeed;
+                length = 0;
+                startTick = tick;
+                recording = true;
+                replaying = false;
+            }
+
+            void stopRecording(Uint64 tick) {
+                if (!recording) return;
+                length = tick - startTick;
+                recording = false;
+            }
+
+            void record(Amara::InputRecord rec, Uint64 tick) {
+                if (!recording) return;
+                rec.tick = tick - startTick;
+                records.push_back(rec);
+            }
+
+            void startReplay(Uint64 tick) {
+                recording = false;
+                replaying = true;
+                replayFinished = false;
+                replayIndex = 0;
+                startTick = tick;
+            }
+
+            void stopReplay() {
+                replaying = false;
+            }
+
+            // Gets the next recorded input for this tick, returns false once the tick has none left.
+            bool next(Uint64 tick, Amara::InputRecord& rec) {
+                if (!replaying) return false;
+                Uint64 current = tick - startTick;
+                if (replayIndex < records.size() && records[replayIndex].tick <= current) {
+                    rec = records[replayIndex];
+                    replayIndex += 1;
+                    return true;
+                }
+                if (replayIndex >= records.size() && current >= length) {
+                    replayFinished = true;
+                    replaying = false;
+                }
+                return false;
+            }
+
+            bool save(std::string path) {
+                std::ofstream file(path, std::ios::out | std::ios::binary);
+                if (!file) {
+                    std::cout << "InputRecorder: Failed to write file \"" << path << "\"" << std::endl;
+                    return false;
+                }
+                file.write("AMRI", 4);
+                writeU32(file, 1);
+                writeU32(file, seed);
+                writeU32(file, length);
+                writeU32(file, records.size());
+
+                for (Amara::InputRecord& rec: records) {
+                    writeU32(file, rec.tick);
+                    file.put(rec.type);
+                    switch (rec.type) {
+                        case INPUT_KEYDOWN:
+                        case INPUT_KEYUP:
+                            writeU32(file, rec.code);
+                            break;
+                        case INPUT_MOUSEMOTION:
+                            writeU32(file, rec.x);
+                            writeU32(file, rec.y);
+                            break;
+                        case INPUT_MOUSEDOWN:
+                        case INPUT_MOUSEUP:
+                            file.put(rec.code);
+                            writeU32(file, rec.x);
+                            writeU32(file, rec.y);
+                            break;
+                        case INPUT_MOUSEWHEEL:
+                            writeU32(file, rec.x);
+                            writeU32(file, rec.y);
+                            break;
+                        case INPUT_GAMEPADCONNECT:
+                        case INPUT_GAMEPADDISCONNECT:
+                            file.put(rec.index);
+                            break;
+                        case INPUT_GAMEPADDOWN:
+                        case INPUT_GAMEPADUP:
+                            file.put(rec.index);
+                            file.put(rec.code);
+                            break;
+                        case INPUT_GAMEPADAXIS:
+                            file.put(rec.index);
+                            file.put(rec.code);
+                            writeU32(file, rec.x);
+                            break;
+                        case INPUT_FINGERDOWN:
+                        case INPUT_FINGERMOTION:
+                        case INPUT_FINGERUP:
+                            writeU32(file, (Uint32)(rec.fingerId & 0xFFFFFFFF));
+                            writeU32(file, (Uint32)(rec.fingerId >> 32));
+                            writeF32(file, rec.fx);
+                            writeF32(file, rec.fy);
+                            break;
+                    }
+                }
+                file.close();
+                return true;
+            }
+
+            bool load(std::string path) {
+                std::ifstream file(path, std::ios::in | std::ios::binary);
+                if (!file) {
+                    std::cout << "InputRecorder: Failed to read file \"" << path << "\"" << std::endl;
+                    return false;
+                }
+                char magic[4];
+                file.read(magic, 4);
+                if (!file || strncmp(magic, "AMRI", 4) != 0) {
+                    std::cout << "InputRecorder: \"" << path << "\" is not an input recording." << std::endl;
+                    return false;
+                }
+                Uint32 version = readU32(file);
+                if (version != 1) {
+                    std::cout << "InputRecorder: Unsupported recording version " << version << "." << std::endl;
+                    return false;
+                }
+                seed = readU32(file);
+                length = readU32(file);
+                Uint32 numRecords = readU32(file);
+
+                records.clear();
+                records.reserve(numRecords);
+                for (Uint32 i = 0; i < numRecords && file; i++) {
+                    Amara::InputRecord rec;
+                    rec.tick = readU32(file);
+                    rec.type = file.get();
+                    switch (rec.type) {
+                        case INPUT_KEYDOWN:
+                        case INPUT_KEYUP:
+                            rec.code = readU32(file);
+                            break;
+                        case INPUT_MOUSEMOTION:
+                            rec.x = readU32(file);
+                            rec.y = readU32(file);
+                            break;
+                        case INPUT_MOUSEDOWN:
+                        case INPUT_MOUSEUP:
+                            rec.code = (Uint8)file.get();
+                            rec.x = readU32(file);
+                            rec.y = readU32(file);
+                            break;
+                        case INPUT_MOUSEWHEEL:
+                            rec.x = readU32(file);
+                            rec.y = readU32(file);
+                            break;
+                        case INPUT_GAMEPADCONNECT:
+                        case INPUT_GAMEPADDISCONNECT:
+                            rec.index = file.get();
+                            break;
+                        case INPUT_GAMEPADDOWN:
+                        case INPUT_GAMEPADUP:
+                            rec.index = file.get();
+                            rec.code = (Uint8)file.get();
+                            break;
+                        case INPUT_GAMEPADAXIS:
+                            rec.index = file.get();
+                            rec.code = (Uint8)file.get();
+                            rec.x = (Sint32)readU32(file);
+                            break;
+                        case INPUT_FINGERDOWN:
+                        case INPUT_FINGERMOTION:
+                        case INPUT_FINGERUP: {
+                            Uint64 low = readU32(file);
+                            Uint64 high = readU32(file);
+                            rec.fingerId = (Sint64)(low | (high << 32));
+                            rec.fx = readF32(file);
+                            rec.fy = readF32(file);
+                            break;
+                        }
+                    }
+                    records.push_back(rec);
+                }
+                file.close();
+
+                if (records.size() != numRecords) {
+                    std::cout << "InputRecorder: \"" << path << "\" is truncated." << std::endl;
+                    return false;
+                }
+                return true;
+            }
+
+        private:
+            void writeU32(std::ofstream& file, Uint32 val) {
+                char bytes[4] = { (char)(val & 0xFF), (char)((val >> 8) & 0xFF), (char)((val >> 16) & 0xFF), (char)((val >> 24) & 0xFF) };
+                file.write(bytes, 4);
+            }
+
+            void writeF32(std::ofstream& file, float val) {
+                Uint32 bits;
+                memcpy(&bits, &val, sizeof(bits));
+                writeU32(file, bits);
+            }
+
+            Uint32 readU32(std::ifstream& file) {
+                unsigned char bytes[4] = { 0, 0, 0, 0 };
+                file.read((char*)bytes, 4);
+                return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((Uint32)bytes[3] << 24);
+            }
+
+            float readF32(std::ifstream& file) {
+                Uint32 bits = readU32(file);
+                float val;
+                memcpy(&val, &bits, sizeof(val));
+                return val;
+            }
+    };
+}
+
+#endif
@@ -49,13 +49,28 @@ namespace Amara {
                 entityType = "container";
             }
 
+        // Children are clipped to the container, so they don't widen its bounds.
+        virtual bool getDrawBounds(Amara::FloatRect& bounds) override {
+            if (scrollFactorX != 1 || scrollFactorY != 1 || zoomFactorX != 1 || zoomFactorY != 1) return false;
+
+            float absScaleX = fabs(scaleX);
+            float absScaleY = fabs(scaleY);
+            bounds.x = x - (originX * width * absScaleX);
+            bounds.y = y - z - (originY * height * absScaleY);
+            bounds.width = width * absScaleX;
+            bounds.height = height * absScaleY;
+            padBoundsForAngle(bounds, x, y - z);
+            return true;
+        }
+
         virtual void draw(int vx, int vy, int vw, int vh) override {
             int dx = 0, dy = 0, dw = 0, dh = 0, ox = 0, oy = 0;
 
-            float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-            float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY; 
-            dx = floor((x - properties->scrollX*scrollFactorX + properties->offsetX - (originX*width*scaleX)) * nzoomX);
-            dy = floor((y-z - properties->scrollY*scrollFactorY + properties->offsetY - (originY*height*scaleY)) * nzoomY);
+            Amara::Transform transform = getDrawTransform();
+            float nzoomX = transform.getZoomX(zoomFactorX);
+            float nzoomY = transform.getZoomY(zoomFactorY); 
+            dx = floor((transform.getScreenX(x, scrollFactorX) - (originX*width*scaleX)) * nzoomX);
+            dy = floor((transform.getScreenY(y-z, scrollFactorY) - (originY*height*scaleY)) * nzoomY);
             dw = width * scaleX * nzoomX;
             dh = height * scaleY * nzoomY;
 
@@ -79,28 +94,27 @@ namespace Amara {
             if (alpha < 0) alpha = 0;
             if (alpha > 1) alpha = 1;
             
-            stable_sort(entities.begin(), entities.end(), sortEntities());
-
-            float recZoomX = properties->zoomX;
-            float recZoomY = properties->zoomY;
-            float recZoomFactorX = properties->zoomFactorX * zoomFactorX;
-            float recZoomFactorY = properties->zoomFactorY * zoomFactorY;
-            float recAlpha = properties->alpha * alpha;
+            sortByDepth(entities);
+
+            // Children are drawn relative to the clipped viewport, under a view of their own.
+            Amara::Transform recView = properties->view;
+            properties->view = transform;
+            properties->view.scrollX = 0;
+            properties->view.scrollY = 0;
+            properties->view.offsetX = ox;
+            properties->view.offsetY = oy;
+            properties->view.zoomX *= scaleX;
+            properties->view.zoomY *= scaleY;
+            properties->view.zoomFactorX *= zoomFactorX;
+            properties->view.zoomFactorY *= zoomFactorY;
+            properties->view.alpha *= alpha;
 
             for (Amara::Entity* entity : entities) {
-                properties->scrollX = 0;
-                properties->scrollY = 0;
-                properties->offsetX = ox;
-                properties->offsetY = oy;
-                properties->zoomX = recZoomX * scaleX;
-                properties->zoomY = recZoomY * scaleY;
-                properties->zoomFactorX = recZoomFactorX;
-                properties->zoomFactorY = recZoomFactorY;
-                properties->alpha = recAlpha;
                 if (entity->isDestroyed || entity->parent != this) continue;
                 if (!entity->isVisible) continue;
                 entity->draw(vx + dx, vy + dy, dw, dh);
             }
+            properties->view = recView;
         }
 
         void setOrigin(float gx, float gy) {
@@ -162,7 +176,7 @@ namespace Amara {
         }
 
         void draw(int vx, int vy, int vw, int vh) {
-            float recAlpha = properties->alpha;
+            float recAlpha = getDrawTransform().alpha;
             if (!textureLocked) {
                 if (textureWidth != properties->resolution->width || textureHeight != properties->resolution->height) {
                     createTexture();
@@ -170,12 +184,14 @@ namespace Amara {
                 if (!tx) return;
 
                 recTarget = SDL_GetRenderTarget(properties->gRenderer);
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, tx);
                 SDL_SetRenderDrawColor(properties->gRenderer, 0, 0, 0, 0);
                 SDL_RenderClear(properties->gRenderer);
                 
                 drawEntities(vx, vy, vw, vh);
 
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, recTarget);
             }
             else {
@@ -191,6 +207,7 @@ namespace Amara {
             viewport.y = 0;
             viewport.w = textureWidth;
             viewport.h = textureHeight;
+            Amara::SpriteBatch::flush(properties);
             SDL_RenderSetViewport(properties->gRenderer, &viewport);
 
             destRect.x = 0;
@@ -232,43 +249,38 @@ namespace Amara {
             if (alpha < 0) alpha = 0;
             if (alpha > 1) alpha = 1;
 
-            float recScrollX = properties->scrollX * scrollFactorX;
-            float recScrollY = properties->scrollY * scrollFactorY;
-            float recOffsetX = properties->offsetX + x;
-            float recOffsetY = properties->offsetY + y;
-            float recZoomX = properties->zoomX * scaleX;
-            float recZoomY = properties->zoomY * scaleY;
-            float recZoomFactorX = properties->zoomFactorX * zoomFactorX;
-            float recZoomFactorY = properties->zoomFactorY * zoomFactorY;
-            float recAngle = properties->angle + angle;
-            float recAlpha = properties->alpha;
-            properties->alpha = 1;
-
-            stable_sort(entities.begin(), entities.end(), sortEntities());
-
+            // The layer's alpha goes on the texture, so children are drawn under a view without it.
+            Amara::WorldTransform own;
+            own.offsetX = x;
+            own.offsetY = y;
+            own.zoomX = scaleX;
+            own.zoomY = scaleY;
+            own.scrollFactorX = scrollFactorX;
+            own.scrollFactorY = scrollFactorY;
+            own.zoomFactorX = zoomFactorX;
+            own.zoomFactorY = zoomFactorY;
+            own.angle = angle;
+            Amara::Transform recView = properties->view;
+            properties->view = getDrawTransform().apply(own);
+            properties->view.alpha = 1;
+
+            sortByDepth(entities);
+
+            bool childrenRemoved = false;
             Amara::Entity* entity;
             for (auto it = entities.begin(); it != entities.end(); ++it) {
                 entity = *it;
 
-                if (entity->isDestroyed || entity->parent != this) {
-                    entities.erase(it--);
+                if (isChildRemoved(entity)) {
+                    childrenRemoved = true;
                     continue;
                 }
                 if (!entity->isVisible) continue;
 
-                properties->scrollX = recScrollX;
-                properties->scrollY = recScrollY;
-                properties->offsetX = recOffsetX;
-                properties->offsetY = recOffsetY;
-                properties->zoomX = recZoomX;
-                properties->zoomY = recZoomY;
-                properties->zoomFactorX = recZoomFactorX;
-                properties->zoomFactorY = recZoomFactorY;
-                properties->angle = recAngle;
-                properties->alpha = 1;
                 entity->draw(vx, vy, vw, vh);
             }
-            properties->alpha = recAlpha;
+            if (childrenRemoved) compactEntities();
+            properties->view = recView;
         }
 
         ~TextureLayer() {
@@ -354,7 +366,8 @@ namespace Amara {
         }
 
         void draw(int vx, int vy, int vw, int vh) {
-            float recAlpha = properties->alpha;
+            Amara::Transform transform = getDrawTransform();
+            float recAlpha = transform.alpha;
             if (!textureLocked) {
                 if (textureWidth != width || textureHeight != height) {
                     createTexture();
@@ -362,12 +375,14 @@ namespace Amara {
                 if (!tx) return;
 
                 recTarget = SDL_GetRenderTarget(properties->gRenderer);
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, tx);
                 SDL_SetRenderDrawColor(properties->gRenderer, 0, 0, 0, 0);
                 SDL_RenderClear(properties->gRenderer);
                 
                 drawEntities(0, 0, width, height);
 
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, recTarget);
             }
             else {
@@ -383,10 +398,11 @@ namespace Amara {
             viewport.y = vy;
             viewport.w = vw;
             viewport.h = vh;
+            Amara::SpriteBatch::flush(properties);
             SDL_RenderSetViewport(properties->gRenderer, &viewport);
 
-            float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-            float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+            float nzoomX = transform.getZoomX(zoomFactorX);
+            float nzoomY = transform.getZoomY(zoomFactorY);
 
             bool scaleFlipHorizontal = false;
             bool scaleFlipVertical = false;
@@ -402,8 +418,8 @@ namespace Amara {
                 scaleY = abs(scaleY);
             }
 
-            destRect.x = ((x - properties->scrollX*scrollFactorX + properties->offsetX - (originX * width * scaleX)) * nzoomX);
-            destRect.y = ((y-z - properties->scrollY*scrollFactorY + properties->offsetY - (originY * height * scaleY)) * nzoomY);
+            destRect.x = ((transform.getScreenX(x, scrollFactorX) - (originX * width * scaleX)) * nzoomX);
+            destRect.y = ((transform.getScreenY(y-z, scrollFactorY) - (originY * height * scaleY)) * nzoomY);
             destRect.w = ((width * scaleX) * nzoomX);
             destRect.h = ((height * scaleY) * nzoomY);
 
@@ -464,52 +480,27 @@ namespace Amara {
             if (alpha < 0) alpha = 0;
             if (alpha > 1) alpha = 1;
 
-            float recScrollX = properties->scrollX;
-            float recScrollY = properties->scrollY;
-            float recOffsetX = properties->offsetX;
-            float recOffsetY = properties->offsetY;
-            float recZoomX = properties->zoomX;
-            float recZoomY = properties->zoomY;
-            float recZoomFactorX = properties->zoomFactorX;
-            float recZoomFactorY = properties->zoomFactorY;
-            float recAngle = properties->angle;
-            float recAlpha = properties->alpha;
-            properties->alpha = 1;
+            // Children are drawn onto the texture untransformed.
+            Amara::Transform recView = properties->view;
+            properties->view.reset();
 
-            stable_sort(entities.begin(), entities.end(), sortEntities());
+            sortByDepth(entities);
 
+            bool childrenRemoved = false;
             Amara::Entity* entity;
             for (auto it = entities.begin(); it != entities.end(); ++it) {
                 entity = *it;
 
-                if (entity->isDestroyed || entity->parent != this) {
-                    entities.erase(it--);
+                if (isChildRemoved(entity)) {
+                    childrenRemoved = true;
                     continue;
                 }
                 if (!entity->isVisible) continue;
 
-                properties->scrollX = 0;
-                properties->scrollY = 0;
-                properties->offsetX = 0;
-                properties->offsetY = 0;
-                properties->zoomX = 1;
-                properties->zoomY = 1;
-                properties->zoomFactorX = 1;
-                properties->zoomFactorY = 1;
-                properties->angle = 0;
-                properties->alpha = 1;
                 entity->draw(vx, vy, vw, vh);
             }
-            properties->alpha = recAlpha;
-            properties->scrollX = recScrollX;
-            properties->scrollY = recScrollY;
-            properties->offsetX = recOffsetX;
-            properties->offsetY = recOffsetY;
-            properties->zoomX = recZoomX;
-            properties->zoomY = recZoomY;
-            properties->zoomFactorX = recZoomFactorX;
-            properties->zoomFactorY = recZoomFactorY;
-            properties->angle = recAngle;
+            if (childrenRemoved) compactEntities();
+            properties->view = recView;
         }
 
         ~TextureContainer() {
@@ -41,6 +41,11 @@ namespace Amara {
                 entityType = "light";
             }
 
+            // Lights are drawn in their layer's place, not under it.
+            int getParentTransformSlot() {
+                return (parent && parent->parent) ? parent->parent->getTransformSlot() : -1;
+            }
+
             void draw(Amara::GameProperties* properties, SDL_Renderer* gRenderer, int vx, int vy, int vw, int vh) {
                 if (texture != nullptr) {
                     Amara::Image::draw(vx, vy, vw, vh);
@@ -48,11 +53,12 @@ namespace Amara {
                 else {
                     bool skipDrawing = false;
 
-                    float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-                    float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+                    Amara::Transform transform = getDrawTransform();
+                    float nzoomX = transform.getZoomX(zoomFactorX);
+                    float nzoomY = transform.getZoomY(zoomFactorY);
                     
-                    destRect.x = floor((x + renderOffsetX - properties->scrollX*scrollFactorX + properties->offsetX - (originX * width * scaleX)) * nzoomX);
-                    destRect.y = floor((y-z + renderOffsetY - properties->scrollY*scrollFactorY + properties->offsetY - (originY * height * scaleY)) * nzoomY);
+                    destRect.x = floor((transform.getScreenX(x + renderOffsetX, scrollFactorX) - (originX * width * scaleX)) * nzoomX);
+                    destRect.y = floor((transform.getScreenY(y-z + renderOffsetY, scrollFactorY) - (originY * height * scaleY)) * nzoomY);
                     destRect.w = ceil((width * scaleX) * nzoomX);
                     destRect.h = ceil((height * scaleY) * nzoomY);
 
@@ -146,25 +152,24 @@ namespace Amara {
                 destroyTexture();
                 lightTexture = SDL_CreateTexture(
                     properties->gRenderer,
-                    SDL_GetWindowPixelFormat(properties->gWindow),
+                    SDL_PIXELFORMAT_RGBA8888,
                     SDL_TEXTUREACCESS_TARGET,
                     floor(width),
                     floor(height)
                 );
                 SDL_QueryTexture(lightTexture, NULL, NULL, &imageWidth, &imageHeight);
+                return lightTexture;
             }
 
             void run() {
-                Amara::Light* light;
-                for (auto it = lights.begin(); it != lights.end(); it++) {
-                    light = *it;
+                for (Amara::Light* light: lights) {
                     if (!light->isDestroyed) {
                         light->run();
                     }
-                    if (light->isDestroyed) {
-                        lights.erase(it--);
-                    }
                 }
+                Amara::compact(lights, [](Amara::Light* light) {
+                    return light->isDestroyed;
+                });
                 
                 Amara::Actor::run();
             }
@@ -183,6 +188,7 @@ namespace Amara {
                 viewport.y = vy;
                 viewport.w = vw;
                 viewport.h = vh;
+                Amara::SpriteBatch::flush(properties);
                 SDL_RenderSetViewport(properties->gRenderer, &viewport);
                 
                 destRect.x = 0;
@@ -14,6 +14,7 @@ namespace Amara {
 
         int frameWidth;
         int frameHeight;
+        std::string atlasKey;
 
         int size;
         int style;
@@ -66,6 +67,19 @@ namespace Amara {
                 load->regenerateAssets();
             }
 
+            Amara::TextureAtlas* createAtlas(std::string key, int pageWidth, int pageHeight) {
+                return load->createAtlas(key, pageWidth, pageHeight);
+            }
+
+            Amara::TextureAtlas* getAtlas(std::string key) {
+                return load->getAtlas(key);
+            }
+
+            bool removeAtlas(std::string key) {
+                if (atlasKey.compare(key) == 0) atlasKey.clear();
+                return load->removeAtlas(key);
+            }
+
             int numTasks() {
                 return tasks.size();
             }
@@ -82,10 +96,10 @@ namespace Amara {
 
                     switch (task->type) {
                         case IMAGE:
-                            success = load->image(task->key, task->path, task->replace);
+                            success = load->image(task->key, task->path, task->replace, task->atlasKey);
                             break;
                         case SPRITESHEET:
-                            success = load->spritesheet(task->key, task->path, task->frameWidth, task->frameHeight, task->replace);
+                            success = load->spritesheet(task->key, task->path, task->frameWidth, task->frameHeight, task->replace, task->atlasKey);
                             break;
                         case STRINGFILE:
                             success = load->json(task->key, task->path, task->replace);
@@ -125,16 +139,22 @@ namespace Amara {
                 tasks.push_back(asset);
             }
 
-            bool image(std::string key, std::string path, bool replace) {
+            bool image(std::string key, std::string path, bool replace, std::string gAtlasKey) {
                 Amara::LoadTask* t  = new Amara::LoadTask();
                 t->type = IMAGE;
                 t->path = path;
                 t->replace = replace;
+                t->atlasKey = gAtlasKey;
                 pushTask(key, t);
                 return true;
             }
 
-            bool spritesheet(std::string key, std::string path, int frameWidth, int frameHeight, bool replace) {
+            // Packed into whatever atlas this manager is packing into when it's queued.
+            bool image(std::string key, std::string path, bool replace) {
+                return image(key, path, replace, atlasKey);
+            }
+
+            bool spritesheet(std::string key, std::string path, int frameWidth, int frameHeight, bool replace, std::string gAtlasKey) {
                 Amara::LoadTask* t  = new Amara::LoadTask();
                 t->type = SPRITESHEET;
                 t->path = path;
@@ -142,10 +162,15 @@ namespace Amara {
                 t->frameWidth = frameWidth;
                 t->frameHeight = frameHeight;
                 t->replace = replace;
+                t->atlasKey = gAtlasKey;
                 pushTask(key, t);
                 return true;
             }
 
+            bool spritesheet(std::string key, std::string path, int frameWidth, int frameHeight, bool replace) {
+                return spritesheet(key, path, frameWidth, frameHeight, replace, atlasKey);
+            }
+
             bool sound(std::string key, std::string path, bool replace) {
 				Amara::LoadTask* t = new Amara::LoadTask();
                 t->type = SOUND;
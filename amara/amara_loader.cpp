@@ -18,6 +18,10 @@ namespace Amara {
             std::unordered_map<std::string, Amara::Asset*> assets;
 			std::string selfkey;
 
+			std::unordered_map<std::string, Amara::TextureAtlas*> atlases;
+			// Images and spritesheets loaded without an atlas key go here, empty for a texture each.
+			std::string atlasKey;
+
 			bool stillLoading = false;
 			int loadSpeed = 64;
 
@@ -32,6 +36,14 @@ namespace Amara {
                 assets.clear();
             }
 
+			// Assets packed into an atlas are left pointing at freed pages, free the loader after them.
+			virtual ~Loader() {
+				for (std::pair<const std::string, Amara::TextureAtlas*>& entry: atlases) {
+					delete entry.second;
+				}
+				atlases.clear();
+			}
+
 			virtual void setLoadSpeed(int speed) {
 				loadSpeed = speed;
 			}
@@ -148,7 +160,10 @@ namespace Amara {
 					if (asset.find("replace") != asset.end()) {
 						replace = asset["replace"];
 					}
-					image(key, path, replace);
+					if (asset.find("atlas") != asset.end()) {
+						image(key, path, replace, asset["atlas"].get<std::string>());
+					}
+					else image(key, path, replace);
 				}
 			}
 			void loadSpritesheetsFromJSON(nlohmann::json& config) {
@@ -165,7 +180,10 @@ namespace Amara {
 					}
 					frameWidth = asset["frameWidth"];
 					frameHeight = asset["frameHeight"];
-					spritesheet(key, path, frameWidth, frameHeight, replace);
+					if (asset.find("atlas") != asset.end()) {
+						spritesheet(key, path, frameWidth, frameHeight, replace, asset["atlas"].get<std::string>());
+					}
+					else spritesheet(key, path, frameWidth, frameHeight, replace);
 				}
 			}
 			void loadTTFsFromJSON(nlohmann::json& config) {
@@ -354,6 +372,69 @@ namespace Amara {
 			virtual void run() {}
 			virtual int numTasks() {}
 
+			/*
+			 * Atlases are shared by every loader, a LoadManager forwards these to the game's loader.
+			 */
+			virtual Amara::TextureAtlas* createAtlas(std::string key, int pageWidth, int pageHeight) {
+				Amara::TextureAtlas* atlas = getAtlas(key);
+				if (atlas != nullptr) {
+					atlas->pageWidth = pageWidth;
+					atlas->pageHeight = pageHeight;
+					return atlas;
+				}
+				atlas = new Amara::TextureAtlas(gRenderer, key, pageWidth, pageHeight);
+				atlases[key] = atlas;
+				return atlas;
+			}
+
+			virtual Amara::TextureAtlas* getAtlas(std::string key) {
+				std::unordered_map<std::string, Amara::TextureAtlas*>::iterator got = atlases.find(key);
+				if (got != atlases.end()) {
+					return got->second;
+				}
+				return nullptr;
+			}
+
+			/*
+			 * Removes every image and spritesheet packed into the atlas, then frees its pages.
+			 */
+			virtual bool removeAtlas(std::string key) {
+				Amara::TextureAtlas* atlas = getAtlas(key);
+				if (atlas == nullptr) return false;
+
+				std::vector<std::string> packed;
+				for (std::pair<const std::string, Amara::Asset*>& entry: assets) {
+					Amara::AssetType type = entry.second->type;
+					if (type != IMAGE && type != SPRITESHEET) continue;
+					Amara::ImageTexture* image = (Amara::ImageTexture*)entry.second;
+					if (!image->ownsTexture && atlas->hasPage(image->asset)) packed.push_back(entry.first);
+				}
+				for (std::string& assetKey: packed) {
+					remove(assetKey);
+				}
+
+				if (atlasKey.compare(key) == 0) atlasKey.clear();
+				atlases.erase(key);
+				delete atlas;
+				return true;
+			}
+
+			/*
+			 * Images and spritesheets loaded after this are packed into the atlas, until stopPacking().
+			 */
+			virtual void packInto(std::string key, int pageWidth, int pageHeight) {
+				createAtlas(key, pageWidth, pageHeight);
+				atlasKey = key;
+			}
+			virtual void packInto(std::string key) {
+				if (getAtlas(key) == nullptr) createAtlas(key, 2048, 2048);
+				atlasKey = key;
+			}
+
+			virtual void stopPacking() {
+				atlasKey.clear();
+			}
+
             /*
 			 * Slow image.
 			 */
@@ -405,7 +486,7 @@ namespace Amara {
             /*
 			 * Fast texture image.
 			 */
-			virtual bool image(std::string key, std::string path, bool replace) {
+			virtual bool image(std::string key, std::string path, bool replace, std::string gAtlasKey) {
 				Amara::Asset* got = get(key);
 				if (got != nullptr && !replace) {
 					std::cout << "Loader: Key \"" << key << "\" has already been used." << std::endl;
@@ -414,6 +495,8 @@ namespace Amara {
 				bool success = true;
 
 				SDL_Texture* newTexture = NULL;
+				SDL_Rect region;
+				bool packed = false;
 				// Load image
 				SDL_Surface* loadedSurface = IMG_Load(path.c_str());
 
@@ -424,10 +507,13 @@ namespace Amara {
 					success = false;
 				}
 				else {
-					// Create texture from surface pixels
-					newTexture = SDL_CreateTextureFromSurface(gRenderer, loadedSurface);
-					if (newTexture == NULL) {
-						std::cout << "Unable to create texture from " << path << ". SDL Error: \n" << SDL_GetError() << std::endl;
+					packed = packSurface(gAtlasKey, loadedSurface, newTexture, region);
+					if (!packed) {
+						// Create texture from surface pixels
+						newTexture = SDL_CreateTextureFromSurface(gRenderer, loadedSurface);
+						if (newTexture == NULL) {
+							std::cout << "Unable to create texture from " << path << ". SDL Error: \n" << SDL_GetError() << std::endl;
+						}
 					}
 
 					//Get rid of old loaded surface
@@ -437,7 +523,9 @@ namespace Amara {
 
 				if (success) {
 					std::cout << "Loaded: " << key << std::endl;
-					Amara::Asset* newAsset = new Amara::ImageTexture(key, IMAGE, newTexture);
+					Amara::Asset* newAsset;
+					if (packed) newAsset = new Amara::ImageTexture(key, IMAGE, newTexture, region);
+					else newAsset = new Amara::ImageTexture(key, IMAGE, newTexture);
 					assets[key] = newAsset;
 					if (got != nullptr) {
 						delete got;
@@ -447,6 +535,10 @@ namespace Amara {
 				return success;
 			}
 
+			virtual bool image(std::string key, std::string path, bool replace) {
+				return image(key, path, replace, atlasKey);
+			}
+
 			virtual bool image(std::string key, std::string path) {
 				return image(key, path, false);
 			}
@@ -454,7 +546,7 @@ namespace Amara {
             /*
 			 *  Spritesheet handles frame width and height.
 			 */
-			virtual bool spritesheet(std::string key, std::string path, int frwidth, int frheight, bool replace) {
+			virtual bool spritesheet(std::string key, std::string path, int frwidth, int frheight, bool replace, std::string gAtlasKey) {
 				Amara::Asset* got = get(key);
 				if (got != nullptr && !replace) {
 					std::cout << "Loader: Key \"" << key << "\" has already been used." << std::endl;
@@ -463,6 +555,8 @@ namespace Amara {
 				bool success = true;
 
 				SDL_Texture* newTexture = NULL;
+				SDL_Rect region;
+				bool packed = false;
 
 				// Load image
 				SDL_Surface* loadedSurface = IMG_Load(path.c_str());
@@ -471,10 +565,14 @@ namespace Amara {
 					success = false;
 				}
 				else {
-					// Create texture from surface pixels
-					newTexture = SDL_CreateTextureFromSurface(gRenderer, loadedSurface);
-					if (newTexture == NULL) {
-						std::cout << "Unable to create texture from " << path << ". SDL Error: " << SDL_GetError() << std::endl;
+					// The sheet goes in whole, so its frames stay in a grid.
+					packed = packSurface(gAtlasKey, loadedSurface, newTexture, region);
+					if (!packed) {
+						// Create texture from surface pixels
+						newTexture = SDL_CreateTextureFromSurface(gRenderer, loadedSurface);
+						if (newTexture == NULL) {
+							std::cout << "Unable to create texture from " << path << ". SDL Error: " << SDL_GetError() << std::endl;
+						}
 					}
 
 					//Get rid of old loaded surface
@@ -483,7 +581,9 @@ namespace Amara {
 
 				if (success) {
 					std::cout << "Loaded: " << key << std::endl;
-					Amara::Spritesheet* newAsset = new Amara::Spritesheet(key, SPRITESHEET, newTexture, frwidth, frheight);
+					Amara::Spritesheet* newAsset;
+					if (packed) newAsset = new Amara::Spritesheet(key, SPRITESHEET, newTexture, region, frwidth, frheight);
+					else newAsset = new Amara::Spritesheet(key, SPRITESHEET, newTexture, frwidth, frheight);
 					assets[key] = newAsset;
 					if (got != nullptr) {
 						delete got;
@@ -493,6 +593,10 @@ namespace Amara {
 				return success;
 			}
 
+			virtual bool spritesheet(std::string key, std::string path, int frwidth, int frheight, bool replace) {
+				return spritesheet(key, path, frwidth, frheight, replace, atlasKey);
+			}
+
 			virtual bool spritesheet(std::string key, std::string path, int frwidth, int frheight) {
 				return spritesheet(key, path, frwidth, frheight, false);
 			}
@@ -708,6 +812,13 @@ namespace Amara {
 				return lineByLine(key, path, false);
 			}
 
+			bool packSurface(std::string gAtlasKey, SDL_Surface* surface, SDL_Texture*& outTexture, SDL_Rect& outRegion) {
+				if (gAtlasKey.empty()) return false;
+				Amara::TextureAtlas* atlas = getAtlas(gAtlasKey);
+				if (atlas == nullptr) atlas = createAtlas(gAtlasKey, 2048, 2048);
+				return atlas->pack(surface, outTexture, outRegion);
+			}
+
 			virtual void regenerateAssets() {
 				std::unordered_map<std::string, Amara::Asset*>::iterator it = assets.begin();
 				while (it != assets.end()) {
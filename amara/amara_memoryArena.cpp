@@ -0,0 +1,210 @@
+#pragma once
+#ifndef AMARA_MEMORYARENA
+#define AMARA_MEMORYARENA
+
+#include "amara.h"
+
+namespace Amara {
+    class MemoryArena;
+
+    // Everything handed out by an arena since it was last retired.
+    struct ArenaGeneration {
+        Amara::MemoryArena* arena = nullptr;
+        std::vector<char*> blocks;
+        size_t offset = 0;
+        size_t live = 0;
+        bool retired = false;
+        std::vector<std::vector<void*>> freeLists;
+    };
+
+    // Sits in front of every Pooled allocation, generation is null for heap allocations.
+    struct alignas(16) ArenaHeader {
+        Amara::ArenaGeneration* generation = nullptr;
+        Uint32 sizeClass = 0;
+    };
+
+    /*
+     * Bump allocator with per size free lists, meant to be owned by a Scene.
+     * Objects still run their destructors one at a time, but retire() lets their memory
+     * go back in bulk once the last object of the retired generation has been deleted.
+     */
+    class MemoryArena {
+        public:
+            static const size_t granularity = 16;
+            static const size_t maxPooledSize = 2048;
+
+            size_t blockSize = 0;
+            std::vector<char*> spareBlocks;
+            Amara::ArenaGeneration* current = nullptr;
+            int numRetired = 0;
+            bool orphaned = false;
+
+            size_t totalAllocations = 0;
+
+            MemoryArena(size_t gBlockSize) {
+                blockSize = (gBlockSize < maxPooledSize) ? maxPooledSize : gBlockSize;
+                current = newGeneration();
+            }
+
+            MemoryArena(): MemoryArena(64*1024) {}
+
+            // Returns nullptr for objects too big to pool, those go to the heap instead.
+            void* allocate(size_t size) {
+                size_t total = size + sizeof(Amara::ArenaHeader);
+                if (total > maxPooledSize) return nullptr;
+                Uint32 sizeClass = (total + granularity - 1) / granularity;
+                size_t classSize = sizeClass * granularity;
+
+                void* mem = nullptr;
+                std::vector<void*>& freeList = current->freeLists[sizeClass];
+                if (!freeList.empty()) {
+                    mem = freeList.back();
+                    freeList.pop_back();
+                }
+                else {
+                    if (current->blocks.empty() || current->offset + classSize > blockSize) {
+                        current->blocks.push_back(takeBlock());
+                        current->offset = 0;
+                    }
+                    mem = current->blocks.back() + current->offset;
+                    current->offset += classSize;
+                }
+
+                Amara::ArenaHeader* header = (Amara::ArenaHeader*)mem;
+                header->generation = current;
+                header->sizeClass = sizeClass;
+                current->live += 1;
+                totalAllocations += 1;
+                return header + 1;
+            }
+
+            void release(Amara::ArenaGeneration* generation, Amara::ArenaHeader* header) {
+                generation->live -= 1;
+                if (generation->retired) {
+                    if (generation->live == 0) {
+                        recycle(generation);
+                        numRetired -= 1;
+                        if (orphaned && numRetired == 0) delete this;
+                    }
+                }
+                else {
+                    generation->freeLists[header->sizeClass].push_back(header);
+                }
+            }
+
+            /*
+             * Starts a fresh generation, call when everything allocated so far is on its way out.
+             * Objects of the old generation stay valid until they are deleted.
+             */
+            void retire() {
+                if (current->live == 0) {
+                    rewind(current);
+                    return;
+                }
+                current->retired = true;
+                numRetired += 1;
+                current = newGeneration();
+            }
+
+            // Frees the spare blocks kept around for reuse.
+            void trim() {
+                for (char* block: spareBlocks) delete [] block;
+                spareBlocks.clear();
+            }
+
+            size_t numLive() {
+                return current->live;
+            }
+
+            // Deletes the arena once nothing allocated from it is alive anymore.
+            void destroy() {
+                retire();
+                recycle(current);
+                current = nullptr;
+                trim();
+                if (numRetired == 0) delete this;
+                else orphaned = true;
+            }
+
+            static void* allocate(Amara::MemoryArena* arena, size_t size) {
+                if (arena) {
+                    void* mem = arena->allocate(size);
+                    if (mem) return mem;
+                }
+                Amara::ArenaHeader* header = (Amara::ArenaHeader*)::operator new(size + sizeof(Amara::ArenaHeader));
+                header->generation = nullptr;
+                header->sizeClass = 0;
+                return header + 1;
+            }
+
+            static void deallocate(void* ptr) {
+                if (ptr == nullptr) return;
+                Amara::ArenaHeader* header = ((Amara::ArenaHeader*)ptr) - 1;
+                if (header->generation == nullptr) {
+                    ::operator delete(header);
+                    return;
+                }
+                Amara::ArenaGeneration* generation = header->generation;
+                generation->arena->release(generation, header);
+            }
+
+            ~MemoryArena() {
+                if (current) recycle(current);
+                trim();
+            }
+
+        private:
+            Amara::ArenaGeneration* newGeneration() {
+                Amara::ArenaGeneration* generation = new Amara::ArenaGeneration();
+                generation->arena = this;
+                generation->freeLists.resize(maxPooledSize/granularity + 1);
+                return generation;
+            }
+
+            char* takeBlock() {
+                if (!spareBlocks.empty()) {
+                    char* block = spareBlocks.back();
+                    spareBlocks.pop_back();
+                    return block;
+                }
+                return new char[blockSize];
+            }
+
+            void rewind(Amara::ArenaGeneration* generation) {
+                for (size_t i = 1; i < generation->blocks.size(); i++) {
+                    spareBlocks.push_back(generation->blocks[i]);
+                }
+                if (generation->blocks.size() > 1) generation->blocks.resize(1);
+                generation->offset = 0;
+                for (std::vector<void*>& freeList: generation->freeLists) freeList.clear();
+            }
+
+            void recycle(Amara::ArenaGeneration* generation) {
+                for (char* block: generation->blocks) spareBlocks.push_back(block);
+                delete generation;
+            }
+    };
+
+    /*
+     * Base for engine objects that can live in a MemoryArena.
+     * Plain new still uses the heap, new (arena) Type(...) allocates from the arena,
+     * and delete works the same for both.
+     */
+    class Pooled {
+        public:
+            static void* operator new(size_t size) {
+                return Amara::MemoryArena::allocate(nullptr, size);
+            }
+            static void* operator new(size_t size, Amara::MemoryArena* arena) {
+                return Amara::MemoryArena::allocate(arena, size);
+            }
+            static void operator delete(void* ptr) {
+                Amara::MemoryArena::deallocate(ptr);
+            }
+            static void operator delete(void* ptr, Amara::MemoryArena* arena) {
+                Amara::MemoryArena::deallocate(ptr);
+            }
+    };
+}
+
+#endif
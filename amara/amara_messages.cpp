@@ -5,6 +5,13 @@
 namespace Amara {
     class Entity;
 
+    // One address per payload type, used to check typed payloads without RTTI.
+    template <class T>
+    const void* messagePayloadType() {
+        static const char key = 0;
+        return &key;
+    }
+
     typedef struct Message {
         Entity* parent = nullptr;
         std::string key;
@@ -12,69 +19,372 @@ namespace Amara {
         bool isActive = true;
         bool isNull = false;
         bool skip = false;
+
+        Amara::StringId channel = 0;
+        Uint64 tick = 0;
+        // Counts up with every publish, so readers can tell which messages they've already seen.
+        Uint64 sequence = 0;
+        void* payload = nullptr;
+        const void* payloadType = nullptr;
+
+        // The typed payload it was published with, or nullptr if it was published with another type.
+        template <class T>
+        T* get() {
+            if (payloadType != messagePayloadType<T>()) return nullptr;
+            return (T*)payload;
+        }
     } Message;
 
-    class MessageQueue {
+    struct MessageSubscription {
+        Amara::Entity* owner = nullptr;
+        std::function<void(Amara::Message&)> callback;
+    };
+
+    struct MessageChannel {
+        std::vector<Amara::Message*> messages;
+        std::vector<Amara::MessageSubscription> subscribers;
+    };
+
+    // Bump allocator for one tick's payloads, reset as a whole once they have all expired.
+    class MessageArena {
+        public:
+            static const size_t blockSize = 16*1024;
+            std::vector<char*> blocks;
+            size_t blockIndex = 0;
+            size_t offset = 0;
+
+            void* allocate(size_t size, size_t alignment) {
+                if (size > blockSize) {
+                    char* big = new char[size];
+                    oversized.push_back(big);
+                    return big;
+                }
+                offset = (offset + alignment - 1) & ~(alignment - 1);
+                if (blocks.empty() || offset + size > blockSize) {
+                    if (!blocks.empty()) blockIndex += 1;
+                    if (blockIndex >= blocks.size()) blocks.push_back(new char[blockSize]);
+                    offset = 0;
+                }
+                void* mem = blocks[blockIndex] + offset;
+                offset += size;
+                return mem;
+            }
+
+            void reset() {
+                for (char* big: oversized) delete [] big;
+                oversized.clear();
+                blockIndex = 0;
+                offset = 0;
+            }
+
+            ~MessageArena() {
+                reset();
+                for (char* block: blocks) delete [] block;
+            }
+
+        private:
+            std::vector<char*> oversized;
+    };
+
+    /*
+     * Messages grouped by hashed channel key, so reading a channel never looks at the others.
+     *
+     * Each tick update() delivers last tick's messages to the channel's subscribers, then expires:
+     * - messages from an entity when that entity next runs (see Entity::updateMessages),
+     * - messages without a sender at the next update(),
+     * - anything older than maxAge ticks, for senders that stopped running.
+     * Setting skip on a message keeps it around for one more of those checks.
+     * Typed payloads are copied into a per tick arena and must be trivially copyable.
+     */
+    class MessageBus {
     public:
-        std::vector<Message> queue;
+        static const Uint64 maxAge = 2;
+        static const int numArenas = maxAge + 2;
+
+        std::unordered_map<Amara::StringId, Amara::MessageChannel> channels;
+        std::vector<Amara::Message*> live;
+        std::unordered_map<Amara::Entity*, std::vector<Amara::Message*>> bySender;
+
+        Uint64 tick = 0;
+        Uint64 numPublished = 0;
 
         static Message nullMessage;
 
-        MessageQueue() {
+        MessageBus() {}
 
-        }
-        
         void update() {
-            for (auto it = queue.begin(); it != queue.end(); ++it) {
-                Message msg = *it;
-                if (msg.parent == nullptr || !msg.isActive) {
-                    if (msg.skip) msg.skip = false;
-                    else {
-                        queue.erase(it--);
-                        continue;
-                    }
+            tick += 1;
+            std::vector<Amara::Message*> toRecycle;
+            toRecycle.swap(expired);
+
+            Amara::compact(live, [this](Amara::Message* msg) {
+                if (msg->isActive && msg->tick + maxAge < tick) {
+                    msg->skip = false;
+                    expire(msg);
                 }
-            }
-        }
+                else if (msg->isActive && msg->parent == nullptr && msg->tick < tick) {
+                    if (msg->skip) msg->skip = false;
+                    else expire(msg);
+                }
+                return !msg->isActive;
+            });
+            dropInactive();
 
-        std::vector<Message>::iterator begin() {
-            return queue.begin();
-        }
-        std::vector<Message>::iterator end() {
-            return queue.end();
+            deliver();
+            recycle(toRecycle);
+            arenas[tick % numArenas].reset();
         }
 
         void clear() {
-            queue.clear();
+            for (Amara::Message* msg: live) {
+                msg->isActive = false;
+                expired.push_back(msg);
+            }
+            live.clear();
+            undelivered.clear();
+            bySender.clear();
+            for (auto& it: channels) it.second.messages.clear();
+            std::vector<Amara::Message*> toRecycle;
+            toRecycle.swap(expired);
+            recycle(toRecycle);
         }
 
         bool empty() {
-            return (queue.size() == 0);
+            return live.empty();
         }
 
         int size() {
-            return queue.size();
+            return live.size();
+        }
+
+        // First message still active on the channel.
+        Message& get(Amara::StringId channel) {
+            auto got = channels.find(channel);
+            if (got == channels.end()) return nullMessage;
+            for (Amara::Message* msg: got->second.messages) {
+                if (msg->isActive) return *msg;
+            }
+            return nullMessage;
         }
 
         Message& get(std::string gKey) {
-            for (auto it = queue.begin(); it != queue.end(); ++it) {
-                Message& msg = *it;
-                if (msg.isActive && gKey.compare(msg.key) == 0) {
-                    return msg;
-                }
+            return get(Amara::hashString(gKey));
+        }
+
+        // First message still active on the channel that was published after the given sequence.
+        Message& getAfter(Amara::StringId channel, Uint64 sequence) {
+            auto got = channels.find(channel);
+            if (got == channels.end()) return nullMessage;
+            for (Amara::Message* msg: got->second.messages) {
+                if (msg->isActive && msg->sequence > sequence) return *msg;
             }
             return nullMessage;
         }
 
         Message& broadcast(std::string key, nlohmann::json gData) {
-            queue.push_back({ nullptr, key, gData });
-            return queue.back();
+            return broadcast(nullptr, key, gData);
         }
 
         Message& broadcast(Amara::Entity* gParent, std::string key, nlohmann::json gData) {
-            queue.push_back({ gParent, key, gData });
-            return queue.back();
+            Amara::Message& msg = publish(gParent, Amara::hashString(key));
+            msg.key = key;
+            msg.data = gData;
+            return msg;
+        }
+
+        Message& publish(Amara::Entity* gParent, Amara::StringId channel) {
+            Amara::Message* msg = takeMessage();
+            msg->parent = gParent;
+            msg->channel = channel;
+            msg->tick = tick;
+            numPublished += 1;
+            msg->sequence = numPublished;
+
+            channels[channel].messages.push_back(msg);
+            live.push_back(msg);
+            undelivered.push_back(msg);
+            if (gParent) bySender[gParent].push_back(msg);
+            return *msg;
+        }
+
+        template <class T>
+        Message& publish(Amara::Entity* gParent, Amara::StringId channel, const T& payload) {
+            static_assert(std::is_trivially_copyable<T>::value, "Message payloads must be trivially copyable.");
+            Amara::Message& msg = publish(gParent, channel);
+            void* mem = arenas[tick % numArenas].allocate(sizeof(T), alignof(T));
+            msg.payload = new (mem) T(payload);
+            msg.payloadType = messagePayloadType<T>();
+            return msg;
+        }
+
+        void subscribe(Amara::StringId channel, Amara::Entity* owner, std::function<void(Amara::Message&)> callback) {
+            // Growing a subscriber list would move the callback that's running, so these wait for deliver() to finish.
+            if (isDelivering) {
+                pendingChannels.push_back(channel);
+                pendingSubscriptions.push_back({ owner, callback });
+                return;
+            }
+            channels[channel].subscribers.push_back({ owner, callback });
+        }
+
+        void unsubscribe(Amara::StringId channel, Amara::Entity* owner) {
+            for (size_t i = 0; i < pendingSubscriptions.size(); i++) {
+                if (pendingChannels[i] == channel && pendingSubscriptions[i].owner == owner) pendingSubscriptions[i].owner = nullptr;
+            }
+            auto got = channels.find(channel);
+            if (got == channels.end()) return;
+            for (Amara::MessageSubscription& sub: got->second.subscribers) {
+                if (sub.owner == owner) sub.owner = nullptr;
+            }
+            unsubscribed = true;
+        }
+
+        void unsubscribe(Amara::Entity* owner) {
+            for (Amara::MessageSubscription& sub: pendingSubscriptions) {
+                if (sub.owner == owner) sub.owner = nullptr;
+            }
+            for (auto& it: channels) {
+                for (Amara::MessageSubscription& sub: it.second.subscribers) {
+                    if (sub.owner == owner) sub.owner = nullptr;
+                }
+            }
+            unsubscribed = true;
+        }
+
+        /*
+         * Expires what the sender published before this point, except skipped messages.
+         * Returns true if some of its messages are still around.
+         */
+        bool expireFrom(Amara::Entity* sender) {
+            auto got = bySender.find(sender);
+            if (got == bySender.end()) return false;
+            bool kept = false;
+            Amara::compact(got->second, [this, &kept](Amara::Message* msg) {
+                if (!msg->isActive) return true;
+                if (msg->skip) {
+                    msg->skip = false;
+                    kept = true;
+                    return false;
+                }
+                expire(msg);
+                removeFrom(channels[msg->channel].messages, msg);
+                return true;
+            });
+            if (got->second.empty()) bySender.erase(got);
+            return kept;
+        }
+
+        // Drops everything the sender published right away, for senders that are being destroyed.
+        void forget(Amara::Entity* sender) {
+            auto got = bySender.find(sender);
+            if (got != bySender.end()) {
+                for (Amara::Message* msg: got->second) {
+                    if (!msg->isActive) continue;
+                    expire(msg);
+                    removeFrom(channels[msg->channel].messages, msg);
+                }
+                bySender.erase(got);
+            }
+            unsubscribe(sender);
+        }
+
+        ~MessageBus() {
+            clear();
+            for (Amara::Message* msg: spare) delete msg;
+        }
+
+    private:
+        std::vector<Amara::Message*> undelivered;
+        std::vector<Amara::Message*> expired;
+        std::vector<Amara::Message*> spare;
+        Amara::MessageArena arenas[numArenas];
+        bool unsubscribed = false;
+
+        bool isDelivering = false;
+        std::vector<Amara::StringId> pendingChannels;
+        std::vector<Amara::MessageSubscription> pendingSubscriptions;
+
+        void expire(Amara::Message* msg) {
+            msg->isActive = false;
+            expired.push_back(msg);
+        }
+
+        void deliver() {
+            std::vector<Amara::Message*> delivering;
+            delivering.swap(undelivered);
+            isDelivering = true;
+            for (Amara::Message* msg: delivering) {
+                if (!msg->isActive) continue;
+                auto got = channels.find(msg->channel);
+                if (got == channels.end()) continue;
+                // Publishing from a callback can rehash channels, the channel itself stays put.
+                Amara::MessageChannel& channel = got->second;
+                for (size_t i = 0; i < channel.subscribers.size(); i++) {
+                    if (channel.subscribers[i].owner == nullptr) continue;
+                    channel.subscribers[i].callback(*msg);
+                }
+            }
+            isDelivering = false;
+
+            // Subscribed from a callback, these hear from next tick's messages on.
+            for (size_t i = 0; i < pendingSubscriptions.size(); i++) {
+                if (pendingSubscriptions[i].owner == nullptr) continue;
+                channels[pendingChannels[i]].subscribers.push_back(std::move(pendingSubscriptions[i]));
+            }
+            pendingChannels.clear();
+            pendingSubscriptions.clear();
+
+            if (unsubscribed) {
+                unsubscribed = false;
+                for (auto& it: channels) {
+                    Amara::compact(it.second.subscribers, [](Amara::MessageSubscription& sub) {
+                        return sub.owner == nullptr;
+                    });
+                }
+            }
+        }
+
+        void dropInactive() {
+            for (auto it = channels.begin(); it != channels.end();) {
+                Amara::MessageChannel& channel = it->second;
+                Amara::compact(channel.messages, [](Amara::Message* msg) {
+                    return !msg->isActive;
+                });
+                if (channel.messages.empty() && channel.subscribers.empty()) it = channels.erase(it);
+                else ++it;
+            }
+            for (auto it = bySender.begin(); it != bySender.end();) {
+                Amara::compact(it->second, [](Amara::Message* msg) {
+                    return !msg->isActive;
+                });
+                if (it->second.empty()) it = bySender.erase(it);
+                else ++it;
+            }
+        }
+
+        // Messages are only reused a tick after they expire, so a Message& stays valid until then.
+        void recycle(std::vector<Amara::Message*>& messages) {
+            for (Amara::Message* msg: messages) {
+                *msg = Amara::Message();
+                spare.push_back(msg);
+            }
+        }
+
+        Amara::Message* takeMessage() {
+            if (spare.empty()) return new Amara::Message();
+            Amara::Message* msg = spare.back();
+            spare.pop_back();
+            return msg;
+        }
+
+        void removeFrom(std::vector<Amara::Message*>& list, Amara::Message* msg) {
+            for (size_t i = 0; i < list.size(); i++) {
+                if (list[i] == msg) {
+                    list.erase(list.begin() + i);
+                    return;
+                }
+            }
         }
     };
-    Message MessageQueue::nullMessage = { nullptr, "null", {}, false, true };
-}
\ No newline at end of file
+    Message MessageBus::nullMessage = { nullptr, "null", {}, false, true };
+}
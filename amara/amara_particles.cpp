@@ -24,6 +24,11 @@ namespace Amara {
                 Amara::Image::init();
                 entityType = "particle";
             }
+
+            // Placed in the system's space, drawn in its place rather than under it.
+            int getParentTransformSlot() {
+                return (parent && parent->parent) ? parent->parent->getTransformSlot() : -1;
+            }
     };
 
     class ParticleSystem: public Amara::Actor {
@@ -58,13 +58,9 @@ namespace Amara {
         }
 
         bool willCollide() {
-            Amara::PhysicsBase* body;
-            for (auto it = collisionTargets.begin(); it != collisionTargets.end(); ++it) {
-                body = *it;
-                if (body->isDestroyed) {
-                    collisionTargets.erase(it--);
-                }
-                else if (willCollideWith(body)) {
+            checkActiveCollisionTargets();
+            for (Amara::PhysicsBase* body: collisionTargets) {
+                if (willCollideWith(body)) {
                     return true;
                 }
             }
@@ -74,13 +70,9 @@ namespace Amara {
         using Amara::PhysicsBase::hasCollided;
         bool hasCollided(bool pushingX, bool pushingY) {
             bool col = false;
-            Amara::PhysicsBase* body;
-            for (auto it = collisionTargets.begin(); it != collisionTargets.end(); ++it) {
-                body = *it;
-                if (body->isDestroyed) {
-                    collisionTargets.erase(it--);
-                }
-                else if (collidesWith(body)) {
+            checkActiveCollisionTargets();
+            for (Amara::PhysicsBase* body: collisionTargets) {
+                if (collidesWith(body)) {
                     bumped = body;
                     if (body->isPushable) {
                         if (pushingX) body->velocityX += velocityX * body->pushFrictionX;
@@ -367,7 +359,7 @@ namespace Amara {
                 sx = body->properties.line.p1.x + (body->properties.line.p2.x - body->properties.line.p1.x)*prog;
                 sy = body->properties.line.p1.y + (body->properties.line.p2.y - body->properties.line.p1.y)*prog;
 
-                Tile& tile = tilemapLayer->getTileAtXY(sx, sy);
+                Amara::Tile tile = tilemapLayer->getTileAtXY(sx, sy);
                 if (tile.id == -1) continue;
                 tx = tile.x * tilemapLayer->tileWidth + px;
                 ty = tile.y * tilemapLayer->tileHeight + py;
@@ -411,14 +403,14 @@ namespace Amara {
                 py += tilemapLayer->tilemapEntity->y;
             }
 
-            Tile& centerTile = tilemapLayer->getTileAtXY(sx, sy);
+            Amara::Tile centerTile = tilemapLayer->getTileAtXY(sx, sy);
             ex = centerTile.x + checkPadding;
             ey = centerTile.y + checkPadding;
             sx = centerTile.x - checkPadding;
             sy = centerTile.y - checkPadding;
             for (int i = sx; i <= ex; i++) {
                 for (int j = sy; j <= ey; j++) {
-                    Tile& tile = tilemapLayer->getTileAt(i, j);
+                    Amara::Tile tile = tilemapLayer->getTileAt(i, j);
                     if (tile.id == -1) continue;
                     tx = tile.x * tilemapLayer->tileWidth + px;
                     ty = tile.y * tilemapLayer->tileHeight + py;
@@ -477,11 +469,10 @@ namespace Amara {
         }
 
         bool collidesWith(Amara::PhysicsBase* other) {
-            for (auto it = members.begin(); it != members.end(); ++it) {
-                Amara::PhysicsBase* body = *it;
-                if (body->isDestroyed) {
-                    members.erase(it--);
-                }
+            Amara::compact(members, [](Amara::PhysicsBase* body) {
+                return body->isDestroyed;
+            });
+            for (Amara::PhysicsBase* body: members) {
                 if (body == other) continue;
                 if (!body->isActive) continue;
                 if (body->collidesWith(other)) {
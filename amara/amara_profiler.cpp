@@ -0,0 +1,226 @@
+#pragma once
+#ifndef AMARA_PROFILER
+#define AMARA_PROFILER
+
+#include "amara.h"
+
+namespace Amara {
+    struct ProfileSample {
+        const char* name = nullptr;
+        Uint64 start = 0;
+        Uint64 end = 0;
+        int depth = 0;
+    };
+
+    struct ProfileFrame {
+        int frame = 0;
+        Uint64 start = 0;
+        Uint64 end = 0;
+        std::vector<Amara::ProfileSample> samples;
+    };
+
+    /*
+     * Records scoped timings for every frame into a ring buffer of recent frames.
+     * Names are expected to be string literals, use intern() for anything built at runtime.
+     */
+    class Profiler {
+        public:
+            static Amara::Profiler* current;
+
+            bool enabled = false;
+
+            std::vector<Amara::ProfileFrame> frames;
+            int capacity = 0;
+            int head = 0;
+            int count = 0;
+            int frameNumber = 0;
+
+            Uint64 frequency = 1;
+            Uint64 origin = 0;
+
+            std::vector<int> openSamples;
+            std::unordered_set<std::string> names;
+
+            Profiler(int gCapacity) {
+                setCapacity(gCapacity);
+                frequency = SDL_GetPerformanceFrequency();
+                origin = SDL_GetPerformanceCounter();
+            }
+
+            Profiler(): Profiler(300) {}
+
+            void setCapacity(int gCapacity) {
+                if (gCapacity < 1) gCapacity = 1;
+                capacity = gCapacity;
+                frames.clear();
+                frames.resize(capacity);
+                head = 0;
+                count = 0;
+                openSamples.clear();
+            }
+
+            void enable() {
+                enabled = true;
+                current = this;
+            }
+            void disable() {
+                enabled = false;
+                openSamples.clear();
+            }
+
+            const char* intern(const std::string& name) {
+                return names.insert(name).first->c_str();
+            }
+
+            void beginFrame() {
+                if (!enabled) return;
+                Amara::ProfileFrame& pFrame = frames[head];
+                pFrame.frame = frameNumber;
+                pFrame.start = SDL_GetPerformanceCounter();
+                pFrame.end = pFrame.start;
+                pFrame.samples.clear();
+                openSamples.clear();
+            }
+
+            void endFrame() {
+                if (!enabled) return;
+                Amara::ProfileFrame& pFrame = frames[head];
+                pFrame.end = SDL_GetPerformanceCounter();
+                while (!openSamples.empty()) end();
+
+                head = (head + 1) % capacity;
+                if (count < capacity) count += 1;
+                frameNumber += 1;
+            }
+
+            void begin(const char* name) {
+                if (!enabled) return;
+                Amara::ProfileFrame& pFrame = frames[head];
+                Amara::ProfileSample sample;
+                sample.name = name;
+                sample.depth = openSamples.size();
+                sample.start = SDL_GetPerformanceCounter();
+                openSamples.push_back(pFrame.samples.size());
+                pFrame.samples.push_back(sample);
+            }
+
+            void end() {
+                if (!enabled || openSamples.empty()) return;
+                Amara::ProfileFrame& pFrame = frames[head];
+                pFrame.samples[openSamples.back()].end = SDL_GetPerformanceCounter();
+                openSamples.pop_back();
+            }
+
+            // Frames are indexed from oldest (0) to most recent (numFrames() - 1).
+            int numFrames() {
+                return count;
+            }
+
+            Amara::ProfileFrame& getFrame(int index) {
+                return frames[(head - count + index + capacity) % capacity];
+            }
+
+            double toMilliseconds(Uint64 ticks) {
+                return (ticks * 1000.0) / frequency;
+            }
+
+            double toMicroseconds(Uint64 ticks) {
+                return (ticks * 1000000.0) / frequency;
+            }
+
+            double getFrameTime(int index) {
+                Amara::ProfileFrame& pFrame = getFrame(index);
+                return toMilliseconds(pFrame.end - pFrame.start);
+            }
+
+            // Average time in milliseconds spent in a named scope per recorded frame.
+            double getAverageTime(std::string name) {
+                if (count == 0) return 0;
+                Uint64 total = 0;
+                for (int i = 0; i < count; i++) {
+                    for (Amara::ProfileSample& sample: getFrame(i).samples) {
+                        if (sample.name && name.compare(sample.name) == 0) {
+                            total += sample.end - sample.start;
+                        }
+                    }
+                }
+                return toMilliseconds(total) / count;
+            }
+
+            nlohmann::json toChromeTrace() {
+                nlohmann::json trace;
+                nlohmann::json& traceEvents = trace["traceEvents"];
+                traceEvents = nlohmann::json::array();
+
+                for (int i = 0; i < count; i++) {
+                    Amara::ProfileFrame& pFrame = getFrame(i);
+                    nlohmann::json evt;
+                    evt["name"] = "frame";
+                    evt["cat"] = "frame";
+                    evt["ph"] = "X";
+                    evt["ts"] = toMicroseconds(pFrame.start - origin);
+                    evt["dur"] = toMicroseconds(pFrame.end - pFrame.start);
+                    evt["pid"] = 0;
+                    evt["tid"] = 0;
+                    evt["args"]["frame"] = pFrame.frame;
+                    traceEvents.push_back(evt);
+
+                    for (Amara::ProfileSample& sample: pFrame.samples) {
+                        nlohmann::json sEvt;
+                        sEvt["name"] = (sample.name) ? sample.name : "unknown";
+                        sEvt["cat"] = "amara";
+                        sEvt["ph"] = "X";
+                        sEvt["ts"] = toMicroseconds(sample.start - origin);
+                        sEvt["dur"] = toMicroseconds(sample.end - sample.start);
+                        sEvt["pid"] = 0;
+                        sEvt["tid"] = 0;
+                        traceEvents.push_back(sEvt);
+                    }
+                }
+                trace["displayTimeUnit"] = "ms";
+                return trace;
+            }
+
+            // Open the result in chrome://tracing or ui.perfetto.dev
+            bool exportChromeTrace(std::string path) {
+                std::ofstream file(path);
+                if (!file) {
+                    std::cout << "Profiler: Failed to write file \"" << path << "\"" << std::endl;
+                    return false;
+                }
+                file << toChromeTrace().dump();
+                file.close();
+                return true;
+            }
+    };
+    Amara::Profiler* Profiler::current = nullptr;
+
+    class ProfileScope {
+        public:
+            Amara::Profiler* profiler = nullptr;
+
+            ProfileScope(Amara::Profiler* gProfiler, const char* name) {
+                if (gProfiler && gProfiler->enabled) {
+                    profiler = gProfiler;
+                    profiler->begin(name);
+                }
+            }
+
+            ProfileScope(const char* name): ProfileScope(Amara::Profiler::current, name) {}
+
+            ~ProfileScope() {
+                if (profiler) profiler->end();
+            }
+    };
+}
+
+#define AMARA_PROFILE_CONCAT_INNER(a, b) a##b
+#define AMARA_PROFILE_CONCAT(a, b) AMARA_PROFILE_CONCAT_INNER(a, b)
+
+#ifndef AMARA_NO_PROFILER
+    #define AMARA_PROFILE_SCOPE(name) Amara::ProfileScope AMARA_PROFILE_CONCAT(amaraProfileScope, __LINE__)(name)
+#else
+    #define AMARA_PROFILE_SCOPE(name)
+#endif
+
+#endif
@@ -0,0 +1,272 @@
+#pragma once
+#ifndef AMARA_PROPERTYSTORE
+#define AMARA_PROPERTYSTORE
+
+#include "amara.h"
+
+namespace Amara {
+    class Entity;
+
+    enum PropertyType {
+        PROPERTY_NONE = 0,
+        PROPERTY_BOOL,
+        PROPERTY_INT,
+        PROPERTY_FLOAT,
+        PROPERTY_STRING,
+        PROPERTY_ENTITY
+    };
+
+    struct Property {
+        Uint8 type = PROPERTY_NONE;
+        double number = 0;
+        Amara::Entity* entity = nullptr;
+        std::string text;
+    };
+
+    /*
+     * Typed values under hashed keys in one open addressed table, for data read every tick.
+     * Keys set through a string are remembered by name so they can be written back to JSON,
+     * entity pointers are never persisted.
+     */
+    class PropertyStore {
+        public:
+            static const size_t notFound = (size_t)-1;
+
+            // Key 0 marks an empty slot.
+            std::vector<Amara::StringId> keys;
+            std::vector<Amara::Property> values;
+            size_t count = 0;
+
+            bool has(Amara::StringId key) {
+                return find(key) != notFound;
+            }
+            bool has(std::string key) {
+                return has(Amara::hashString(key));
+            }
+
+            Amara::Property* get(Amara::StringId key) {
+                size_t slot = find(key);
+                if (slot == notFound) return nullptr;
+                return &values[slot];
+            }
+
+            void set(Amara::StringId key, bool val) {
+                Amara::Property& prop = insert(key);
+                prop.type = PROPERTY_BOOL;
+                prop.number = val;
+            }
+            void set(Amara::StringId key, int val) {
+                Amara::Property& prop = insert(key);
+                prop.type = PROPERTY_INT;
+                prop.number = val;
+            }
+            void set(Amara::StringId key, double val) {
+                Amara::Property& prop = insert(key);
+                prop.type = PROPERTY_FLOAT;
+                prop.number = val;
+            }
+            void set(Amara::StringId key, std::string val) {
+                Amara::Property& prop = insert(key);
+                prop.type = PROPERTY_STRING;
+                prop.text = val;
+            }
+            void set(Amara::StringId key, const char* val) {
+                set(key, std::string(val));
+            }
+            void set(Amara::StringId key, Amara::Entity* val) {
+                Amara::Property& prop = insert(key);
+                prop.type = PROPERTY_ENTITY;
+                prop.entity = val;
+            }
+
+            template <class T>
+            void set(std::string key, T val) {
+                set(Amara::StringIds::intern(key), val);
+            }
+
+            // Numbers convert between each other, anything else gives back the default.
+            bool getBool(Amara::StringId key, bool defaultVal) {
+                Amara::Property* prop = get(key);
+                if (prop == nullptr || !isNumeric(prop)) return defaultVal;
+                return prop->number != 0;
+            }
+            bool getBool(Amara::StringId key) {
+                return getBool(key, false);
+            }
+
+            int getInt(Amara::StringId key, int defaultVal) {
+                Amara::Property* prop = get(key);
+                if (prop == nullptr || !isNumeric(prop)) return defaultVal;
+                return (int)prop->number;
+            }
+            int getInt(Amara::StringId key) {
+                return getInt(key, 0);
+            }
+
+            double getFloat(Amara::StringId key, double defaultVal) {
+                Amara::Property* prop = get(key);
+                if (prop == nullptr || !isNumeric(prop)) return defaultVal;
+                return prop->number;
+            }
+            double getFloat(Amara::StringId key) {
+                return getFloat(key, 0);
+            }
+
+            std::string getString(Amara::StringId key, std::string defaultVal) {
+                Amara::Property* prop = get(key);
+                if (prop == nullptr || prop->type != PROPERTY_STRING) return defaultVal;
+                return prop->text;
+            }
+            std::string getString(Amara::StringId key) {
+                return getString(key, "");
+            }
+
+            Amara::Entity* getEntity(Amara::StringId key) {
+                Amara::Property* prop = get(key);
+                if (prop == nullptr || prop->type != PROPERTY_ENTITY) return nullptr;
+                return prop->entity;
+            }
+
+            // Same as isDataProperty, only true for a bool that is set.
+            bool isTrue(Amara::StringId key) {
+                Amara::Property* prop = get(key);
+                return prop != nullptr && prop->type == PROPERTY_BOOL && prop->number != 0;
+            }
+
+            bool remove(Amara::StringId key) {
+                size_t slot = find(key);
+                if (slot == notFound) return false;
+
+                // Shifts the rest of the probe chain back so lookups never stop early.
+                size_t mask = keys.size() - 1;
+                size_t hole = slot;
+                size_t next = (slot + 1) & mask;
+                while (keys[next] != 0) {
+                    size_t home = toSlot(keys[next]);
+                    if (((next - home) & mask) >= ((next - hole) & mask)) {
+                        keys[hole] = keys[next];
+                        values[hole] = values[next];
+                        hole = next;
+                    }
+                    next = (next + 1) & mask;
+                }
+                keys[hole] = 0;
+                values[hole] = Amara::Property();
+                count -= 1;
+                return true;
+            }
+
+            void clear() {
+                keys.clear();
+                values.clear();
+                count = 0;
+            }
+
+            size_t size() {
+                return count;
+            }
+
+            // Takes a JSON value for a key that's already in the store, returns false otherwise.
+            bool read(const std::string& key, const nlohmann::json& val) {
+                Amara::StringId id = Amara::hashString(key);
+                if (!has(id)) return false;
+                return readValue(id, val);
+            }
+
+            // Takes every bool, number and string from a JSON object.
+            void readJson(const nlohmann::json& json) {
+                if (!json.is_object()) return;
+                for (auto& item: json.items()) {
+                    readValue(Amara::StringIds::intern(item.key()), item.value());
+                }
+            }
+
+            void writeJson(nlohmann::json& json) {
+                for (size_t i = 0; i < keys.size(); i++) {
+                    if (keys[i] == 0) continue;
+                    std::string name = Amara::StringIds::name(keys[i]);
+                    if (name.empty()) continue;
+
+                    Amara::Property& prop = values[i];
+                    switch (prop.type) {
+                        case PROPERTY_BOOL:
+                            json[name] = (prop.number != 0);
+                            break;
+                        case PROPERTY_INT:
+                            json[name] = (int)prop.number;
+                            break;
+                        case PROPERTY_FLOAT:
+                            json[name] = prop.number;
+                            break;
+                        case PROPERTY_STRING:
+                            json[name] = prop.text;
+                            break;
+                    }
+                }
+            }
+
+        private:
+            size_t toSlot(Amara::StringId key) {
+                return (size_t)(key ^ (key >> 32)) & (keys.size() - 1);
+            }
+
+            size_t find(Amara::StringId key) {
+                if (count == 0) return notFound;
+                size_t mask = keys.size() - 1;
+                size_t slot = toSlot(key);
+                while (keys[slot] != 0) {
+                    if (keys[slot] == key) return slot;
+                    slot = (slot + 1) & mask;
+                }
+                return notFound;
+            }
+
+            Amara::Property& insert(Amara::StringId key) {
+                size_t slot = find(key);
+                if (slot != notFound) return values[slot];
+
+                if ((count + 1) * 4 > keys.size() * 3) grow();
+                size_t mask = keys.size() - 1;
+                slot = toSlot(key);
+                while (keys[slot] != 0) slot = (slot + 1) & mask;
+                keys[slot] = key;
+                values[slot] = Amara::Property();
+                count += 1;
+                return values[slot];
+            }
+
+            void grow() {
+                std::vector<Amara::StringId> oldKeys;
+                std::vector<Amara::Property> oldValues;
+                oldKeys.swap(keys);
+                oldValues.swap(values);
+
+                size_t capacity = (oldKeys.empty()) ? 8 : oldKeys.size() * 2;
+                keys.assign(capacity, 0);
+                values.resize(capacity);
+                size_t mask = capacity - 1;
+                for (size_t i = 0; i < oldKeys.size(); i++) {
+                    if (oldKeys[i] == 0) continue;
+                    size_t slot = toSlot(oldKeys[i]);
+                    while (keys[slot] != 0) slot = (slot + 1) & mask;
+                    keys[slot] = oldKeys[i];
+                    values[slot] = std::move(oldValues[i]);
+                }
+            }
+
+            bool isNumeric(Amara::Property* prop) {
+                return prop->type == PROPERTY_BOOL || prop->type == PROPERTY_INT || prop->type == PROPERTY_FLOAT;
+            }
+
+            bool readValue(Amara::StringId id, const nlohmann::json& val) {
+                if (val.is_boolean()) set(id, (bool)val);
+                else if (val.is_number_integer()) set(id, (int)val);
+                else if (val.is_number_float()) set(id, (double)val);
+                else if (val.is_string()) set(id, val.get<std::string>());
+                else return false;
+                return true;
+            }
+    };
+}
+
+#endif
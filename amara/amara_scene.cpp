@@ -9,6 +9,20 @@ namespace Amara {
     class ScenePlugin;
     class AssetManager;
 
+    /*
+     * Area where a scene's entities keep running. Follows a camera's view grown by margin,
+     * a circle of radius margin around a target, or else stays at a fixed rect.
+     */
+    struct ActivityRegion {
+        Amara::Camera* camera = nullptr;
+        Amara::Entity* target = nullptr;
+        float x = 0;
+        float y = 0;
+        float width = 0;
+        float height = 0;
+        float margin = 0;
+    };
+
     class Scene: public Amara::Actor {
         public:
             std::string key;
@@ -20,8 +34,19 @@ namespace Amara {
             Amara::Camera* mainCamera = nullptr;
             std::vector<Amara::Camera*> cameras;
 
+            // Off unless enableSpatialIndex() is called, cameras then only draw what's in view.
+            Amara::SpatialIndex* spatialIndex = nullptr;
+            // Set by the update, drawing then only has to re-index what's still interpolating.
+            bool spatialIndexUpdated = false;
+
+            // While there are any, top level entities outside all of them go dormant and skip run().
+            std::vector<Amara::ActivityRegion> activityRegions;
+
             bool initialLoaded = false;
 
+            const char* profileRunName = "scene.run";
+            const char* profileDrawName = "scene.draw";
+
             Scene(): Actor() {
 
             }
@@ -37,6 +62,8 @@ namespace Amara {
                 messages = properties->messages;
 
                 scene = this;
+                if (entityIndex == nullptr) entityIndex = new Amara::EntityIndex();
+                if (tweens == nullptr) tweens = new Amara::TweenSystem(properties);
 
                 if (loadManager != nullptr) {
                     delete loadManager;
@@ -53,6 +80,9 @@ namespace Amara {
             virtual void init() {
                 initialLoaded = false;
 
+                // Whatever the last run allocated is on its way out, start a new generation.
+                if (arena) arena->retire();
+
                 setLoader(loadManager);
                 load->reset();
 
@@ -62,14 +92,18 @@ namespace Amara {
                 cameras.clear();
                 mainCamera = nullptr;
 
+                if (spatialIndex) spatialIndex->clear();
+                activityRegions.clear();
+
                 std::vector<Entity*> toDestroy = entities;
                 for (Amara::Entity* entity: toDestroy) {
                     if (entity->isDestroyed || entity->scene != this) continue;
                     entity->destroy();
                 }
                 entities.clear();
+                if (tweens) tweens->clear();
 
-                add(mainCamera = new Amara::Camera());
+                add(mainCamera = new (arena) Amara::Camera());
                 preload();
                 std::cout << "START LOADING TASKS: " << load->numTasks() << " loading tasks." << std::endl;
 
@@ -89,6 +123,41 @@ namespace Amara {
                 return cam;
             }
 
+            virtual Amara::Entity* remove(Amara::Entity* entity) {
+                if (spatialIndex) spatialIndex->remove(entity);
+                return Amara::Actor::remove(entity);
+            }
+
+            virtual Amara::Entity* remove(size_t index) {
+                if (spatialIndex) spatialIndex->remove(entities.at(index));
+                return Amara::Actor::remove(index);
+            }
+
+            virtual void removeEntities() {
+                if (spatialIndex) spatialIndex->clear();
+                Amara::Actor::removeEntities();
+            }
+
+            // Removed entities have to leave the index before the TaskManager gets to delete them.
+            virtual void compactEntities() {
+                if (spatialIndex) {
+                    for (Amara::Entity* entity: entities) {
+                        if (isChildRemoved(entity)) spatialIndex->remove(entity);
+                    }
+                }
+                Amara::Actor::compactEntities();
+            }
+
+            bool isCameraRemoved(Amara::Camera* cam) {
+                return cam->isDestroyed || cam->parent != this;
+            }
+
+            void compactCameras() {
+                Amara::compact(cameras, [this](Amara::Camera* cam) {
+                    return isCameraRemoved(cam);
+                });
+            }
+
             virtual Amara::Entity* removeCamera(size_t index) {
 				Amara::Entity* child = entities.at(index);
 				child->parent = nullptr;
@@ -165,41 +234,44 @@ namespace Amara {
                 update();
                 reciteScripts();
 
+                bool cullActivity = !activityRegions.empty();
                 Amara::Entity* entity;
-                for (auto it = entities.begin(); it != entities.end(); ++it) {
-                    entity = *it;
-                    if (entity->isDestroyed || entity->parent != this) {
-                        entities.erase(it--);
-                    }
-                    else {
-                        entity->run();
-                        if (entity->isDestroyed || entity->parent != this) {
-                            entities.erase(it--);
-                        }
-                    }
-                }  
+                for (size_t i = 0; i < entities.size(); i++) {
+                    entity = entities[i];
+                    if (isChildRemoved(entity)) continue;
+                    if (cullActivity && !updateActivity(entity)) continue;
+                    entity->recordPreviousPosition();
+                    entity->run();
+                }
+                // After every entity has recorded its previous position, so tweened fields still interpolate.
+                tweens->update();
+                compactEntities();
+                updateSpatialIndex();
+                spatialIndexUpdated = true;
+                pruneActivityRegions();
 
                 Amara::Camera* cam;
-                for (auto it = cameras.begin(); it != cameras.end(); ++it) {
-                    cam = *it;
-                    if (cam->isDestroyed || cam->parent != this) {
-                        cameras.erase(it--);
-                    }
-                    else {
-                        cam->run();
-                    }
+                for (size_t i = 0; i < cameras.size(); i++) {
+                    cam = cameras[i];
+                    if (isCameraRemoved(cam)) continue;
+                    cam->recordPreviousScroll();
+                    cam->run();
                 }
+                compactCameras();
 
                 afterUpdate();
             }
 
             virtual void draw() {
                 properties->currentScene = this;
-				properties->scrollX = 0;
-				properties->scrollY = 0;
+				properties->view.reset();
 
-                stable_sort(cameras.begin(), cameras.end(), sortEntities());
-                stable_sort(entities.begin(), entities.end(), sortEntities());
+                sortByDepth(cameras);
+                sortByDepth(entities);
+                if (spatialIndexUpdated) updateInterpolatingInSpatialIndex();
+                else updateSpatialIndex();
+                spatialIndexUpdated = false;
+                pruneActivityRegions();
 
                 float offset, upScale;
                 int vx, vy = 0;
@@ -217,15 +289,19 @@ namespace Amara {
                     vy += offset/upScale;
                 }
 
+                bool camerasRemoved = false;
                 Amara::Camera* cam;
                 for (std::vector<Amara::Camera*>::iterator it = cameras.begin(); it != cameras.end(); it++) {
                     cam = *it;
-                    if (cam->isDestroyed || cam->parent != this) {
-                        cameras.erase(it--);
+                    if (isCameraRemoved(cam)) {
+                        camerasRemoved = true;
+                        continue;
                     }
                     cam->transition = transition;
+                    cam->spatialIndex = spatialIndex;
                     cam->draw(vx, vy, properties->resolution->width, properties->resolution->height);
                 }
+                if (camerasRemoved) compactCameras();
 
                 afterDraw();
             }
@@ -250,12 +326,152 @@ namespace Amara {
 
             virtual void destroyEntities() {
                 Amara::Entity::destroyEntities();
+                // Regions can follow the cameras, they'd be read after the delete otherwise.
+                activityRegions.clear();
                 for (Amara::Camera* cam: cameras) {
                     delete cam;
                 }
                 cameras.clear();
             }
 
+            /*
+             * Keeps a uniform grid of the scene's top level entities by their draw bounds.
+             * Worth it for big worlds where most entities are off screen at any time.
+             */
+            void enableSpatialIndex(float cellSize) {
+                if (spatialIndex == nullptr) spatialIndex = new Amara::SpatialIndex(cellSize);
+                else spatialIndex->cellSize = cellSize;
+                spatialIndex->clear();
+                updateSpatialIndex();
+            }
+            void enableSpatialIndex() {
+                enableSpatialIndex(256);
+            }
+
+            void disableSpatialIndex() {
+                if (spatialIndex == nullptr) return;
+                spatialIndex->clear();
+                delete spatialIndex;
+                spatialIndex = nullptr;
+            }
+
+            // Regions go before whatever they follow is deleted at the end of the frame.
+            void pruneActivityRegions() {
+                if (activityRegions.empty()) return;
+                size_t removed = Amara::compact(activityRegions, [](Amara::ActivityRegion& region) {
+                    if (region.camera && region.camera->isDestroyed) return true;
+                    if (region.target && region.target->isDestroyed) return true;
+                    return false;
+                });
+                if (removed > 0 && activityRegions.empty()) wakeEntities();
+            }
+
+            // Runs after every update, and before drawing when no update ran since the last draw.
+            void updateSpatialIndex() {
+                if (spatialIndex == nullptr) return;
+                for (Amara::Entity* entity: entities) {
+                    if (isChildRemoved(entity)) continue;
+                    spatialIndex->update(entity);
+                }
+            }
+
+            // Only the interpolation changes between the update and drawing, the rest keep their bounds.
+            void updateInterpolatingInSpatialIndex() {
+                if (spatialIndex == nullptr) return;
+                for (Amara::Entity* entity: entities) {
+                    if (isChildRemoved(entity) || !entity->isInterpolating()) continue;
+                    spatialIndex->update(entity);
+                }
+            }
+
+            // Top level entities with bounds touching the rect, as of the last update or draw.
+            std::vector<Amara::Entity*> queryRect(float gx, float gy, float gw, float gh) {
+                std::vector<Amara::Entity*> found;
+                if (spatialIndex) spatialIndex->queryRect(gx, gy, gw, gh, found, false);
+                return found;
+            }
+
+            std::vector<Amara::Entity*> queryRadius(float gx, float gy, float radius) {
+                std::vector<Amara::Entity*> found;
+                if (spatialIndex) spatialIndex->queryRadius(gx, gy, radius, found);
+                return found;
+            }
+
+            void addActivityRegion(Amara::Camera* cam, float margin) {
+                Amara::ActivityRegion region;
+                region.camera = cam;
+                region.margin = margin;
+                activityRegions.push_back(region);
+            }
+            void addActivityRegion(Amara::Camera* cam) {
+                addActivityRegion(cam, 0);
+            }
+
+            void addActivityRegion(Amara::Entity* target, float radius) {
+                Amara::ActivityRegion region;
+                region.target = target;
+                region.margin = radius;
+                activityRegions.push_back(region);
+            }
+
+            void addActivityRegion(float gx, float gy, float gw, float gh) {
+                Amara::ActivityRegion region;
+                region.x = gx;
+                region.y = gy;
+                region.width = gw;
+                region.height = gh;
+                activityRegions.push_back(region);
+            }
+
+            void removeActivityRegions(Amara::Entity* followed) {
+                Amara::compact(activityRegions, [followed](Amara::ActivityRegion& region) {
+                    return region.target == followed || region.camera == followed;
+                });
+                if (activityRegions.empty()) wakeEntities();
+            }
+
+            void clearActivityRegions() {
+                activityRegions.clear();
+                wakeEntities();
+            }
+
+            bool inActivityRegion(float gx, float gy) {
+                for (Amara::ActivityRegion& region: activityRegions) {
+                    if (region.camera) {
+                        Amara::Camera* cam = region.camera;
+                        float viewW = cam->width/(cam->zoomX*cam->zoomScale);
+                        float viewH = cam->height/(cam->zoomY*cam->zoomScale);
+                        if (gx >= cam->scrollX - region.margin && gx <= cam->scrollX + viewW + region.margin
+                            && gy >= cam->scrollY - region.margin && gy <= cam->scrollY + viewH + region.margin) {
+                            return true;
+                        }
+                    }
+                    else if (region.target) {
+                        float dx = gx - region.target->x;
+                        float dy = gy - region.target->y;
+                        if (dx*dx + dy*dy <= region.margin*region.margin) return true;
+                    }
+                    else if (gx >= region.x && gx <= region.x + region.width && gy >= region.y && gy <= region.y + region.height) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Puts the entity to sleep or wakes it up, returns whether it should run this tick.
+            bool updateActivity(Amara::Entity* entity) {
+                bool active = entity->alwaysActive || inActivityRegion(entity->x, entity->y);
+                entity->setDormant(!active);
+                return active;
+            }
+
+            void wakeEntities() {
+                for (Amara::Entity* entity: entities) {
+                    if (isChildRemoved(entity)) continue;
+                    entity->setDormant(false);
+                }
+            }
+
             virtual void preload() {}
             virtual void create() {}
             virtual void update() {}
@@ -270,8 +486,34 @@ namespace Amara {
             virtual void afterUpdate() {}
             virtual void afterDraw() {}
 
+            /*
+             * Entities, scripts and physics created with addNew(), reciteNew() and addNewPhysics()
+             * under this scene are allocated from a scene owned arena.
+             */
+            void enableArena(size_t blockSize) {
+                if (arena == nullptr) arena = new Amara::MemoryArena(blockSize);
+            }
+            void enableArena() {
+                if (arena == nullptr) arena = new Amara::MemoryArena();
+            }
+
             ~Scene() {
                 delete load;
+                if (spatialIndex) delete spatialIndex;
+                clearScripts();
+                if (entityIndex) {
+                    for (Amara::Entity* entity: entityIndex->all.members) {
+                        entity->entityIndex = nullptr;
+                        entity->tweens = nullptr;
+                    }
+                    delete entityIndex;
+                    entityIndex = nullptr;
+                }
+                if (tweens) {
+                    delete tweens;
+                    tweens = nullptr;
+                }
+                if (arena) arena->destroy();
             }
     };
 }
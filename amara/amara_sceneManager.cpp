@@ -25,6 +25,10 @@ namespace Amara {
 				sceneList.push_back(scene);
 				scene->setup(properties, new ScenePlugin(key, properties, scene, &sceneMap, &sceneList));
 				scene->key = key;
+				if (properties->profiler) {
+					scene->profileRunName = properties->profiler->intern("run:" + key);
+					scene->profileDrawName = properties->profiler->intern("draw:" + key);
+				}
 				std::cout << "ADDED SCENE: " << scene->scenes->key << std::endl;
 				if (willStart) scene->scenes->start();
 				return scene;
@@ -55,6 +59,7 @@ namespace Amara {
 					if (scenes->isPaused) continue;
 					if (scenes->isSleeping) continue;
 
+					AMARA_PROFILE_SCOPE(scene->profileRunName);
 					scene->run();
 				}
 			}
@@ -69,6 +74,8 @@ namespace Amara {
 
 					if (!scenes->isActive) continue;
 					if (scenes->isSleeping) continue;
+
+					AMARA_PROFILE_SCOPE(scene->profileDrawName);
 					scene->draw();
 				}
 			}
@@ -104,6 +111,13 @@ namespace Amara {
 					scenes->manageTasks();
 				}
 			}
+
+			// Drops regions following anything destroyed this frame, before the task manager deletes it.
+			void pruneActivityRegions() {
+				for (Amara::Scene* scene: sceneList) {
+					scene->pruneActivityRegions();
+				}
+			}
 	};
 }
 
@@ -9,8 +9,27 @@ namespace Amara {
     class Scene;
     class Actor;
 
-    class Script: public Amara::StateManager {
+    // Scripts made with plain new come from here, so finished ones hand their memory to the next.
+    inline Amara::MemoryArena* getScriptPool() {
+        static Amara::MemoryArena* pool = new Amara::MemoryArena();
+        return pool;
+    }
+
+    class Script: public Amara::StateManager, public Amara::Pooled {
         public:
+            static void* operator new(size_t size) {
+                return Amara::MemoryArena::allocate(getScriptPool(), size);
+            }
+            static void* operator new(size_t size, Amara::MemoryArena* arena) {
+                return Amara::MemoryArena::allocate((arena) ? arena : getScriptPool(), size);
+            }
+            static void operator delete(void* ptr) {
+                Amara::MemoryArena::deallocate(ptr);
+            }
+            static void operator delete(void* ptr, Amara::MemoryArena* arena) {
+                Amara::MemoryArena::deallocate(ptr);
+            }
+
             Amara::GameProperties* properties = nullptr;
             Amara::Game* game = nullptr;
             Amara::Scene* scene = nullptr;
@@ -20,7 +39,7 @@ namespace Amara {
             Amara::AudioGroup* audio = nullptr;
             Amara::AssetManager* assets = nullptr;
             Amara::Loader* load = nullptr;
-            Amara::MessageQueue* messages = nullptr;
+            Amara::MessageBus* messages = nullptr;
 
 			std::string id;
 
@@ -29,6 +48,12 @@ namespace Amara {
 
             Amara::Script* chainedScript = nullptr;
 
+            // Told when this script is deleted, lets a CoroutineScript wait on it.
+            Amara::Script* awaitedBy = nullptr;
+
+            // Next script in the parent actor's run list.
+            Amara::Script* nextScript = nullptr;
+
             Script(bool deleteWhenDone): Amara::StateManager() {
                 deleteOnFinish = deleteWhenDone;
             }
@@ -95,12 +120,25 @@ namespace Amara {
 				Message& msg = ((Entity*)parent)->broadcastMessage(key, gData);
                 return msg;
 			}
+            Message& broadcastMessage(Amara::StringId channel) {
+				return ((Entity*)parent)->broadcastMessage(channel);
+			}
+            template <class T>
+            Message& broadcastMessage(Amara::StringId channel, const T& payload) {
+				return ((Entity*)parent)->broadcastMessage(channel, payload);
+			}
 			Message& getMessage(std::string key) {
 				return properties->messages->get(key);
 			}
+			Message& getMessage(Amara::StringId channel) {
+				return properties->messages->get(channel);
+			}
             virtual void receiveMessages() {}
 
-            ~Script() {
+            virtual void onAwaitedDeleted(Amara::Script* gScript) {}
+
+            virtual ~Script() {
+                if (awaitedBy) awaitedBy->onAwaitedDeleted(this);
                 if (deleteChainOnDelete && chainedScript) {
                     delete chainedScript;
                 }
@@ -0,0 +1,166 @@
+#pragma once
+#ifndef AMARA_SPATIALINDEX
+#define AMARA_SPATIALINDEX
+
+#include "amara.h"
+
+namespace Amara {
+    // Same order as a depth sorted child list, ties go to whichever was added first.
+    struct sortByDrawOrder {
+        inline bool operator() (Amara::Entity* entity1, Amara::Entity* entity2) {
+            if (entity1->depth != entity2->depth) return entity1->depth < entity2->depth;
+            return entity1->addSequence < entity2->addSequence;
+        }
+    };
+
+    /*
+     * Uniform grid over a scene's top level entities, keyed by the cells their bounds cover.
+     * Entities without bounds are kept aside, cameras always draw them.
+     */
+    class SpatialIndex {
+        public:
+            float cellSize = 256;
+            std::unordered_map<Sint64, std::vector<Amara::Entity*>> cells;
+            std::vector<Amara::Entity*> unbounded;
+            Uint32 queryStamp = 0;
+
+            SpatialIndex(float gCellSize) {
+                cellSize = (gCellSize > 0) ? gCellSize : 256;
+            }
+
+            SpatialIndex(): SpatialIndex(256) {}
+
+            // Reinserts the entity if its bounds moved to other cells.
+            void update(Amara::Entity* entity) {
+                Amara::SpatialEntry& entry = entity->spatialEntry;
+                if (entry.indexed && entity->staticBounds && !entry.boundsChanged) return;
+                entry.boundsChanged = false;
+                Amara::FloatRect bounds;
+                bool bounded = entity->getDrawBounds(bounds);
+                if (entry.indexed && entry.bounded == bounded) {
+                    if (!bounded) return;
+                    entry.bounds = bounds;
+                    Amara::IntRect range = toCellRange(bounds);
+                    if (sameRange(range, entry.cells)) return;
+                }
+                remove(entity);
+                insert(entity, bounded, bounds);
+            }
+
+            void remove(Amara::Entity* entity) {
+                Amara::SpatialEntry& entry = entity->spatialEntry;
+                if (!entry.indexed) return;
+                entry.indexed = false;
+                if (!entry.bounded) {
+                    removeFrom(unbounded, entity);
+                    return;
+                }
+                for (int cy = entry.cells.y; cy < entry.cells.y + entry.cells.height; cy++) {
+                    for (int cx = entry.cells.x; cx < entry.cells.x + entry.cells.width; cx++) {
+                        auto got = cells.find(toKey(cx, cy));
+                        if (got == cells.end()) continue;
+                        removeFrom(got->second, entity);
+                        if (got->second.empty()) cells.erase(got);
+                    }
+                }
+            }
+
+            void clear() {
+                for (auto& it: cells) {
+                    for (Amara::Entity* entity: it.second) entity->spatialEntry.indexed = false;
+                }
+                for (Amara::Entity* entity: unbounded) entity->spatialEntry.indexed = false;
+                cells.clear();
+                unbounded.clear();
+            }
+
+            // Every entity whose bounds overlap the rect once, optionally with the unbounded ones.
+            void queryRect(float qx, float qy, float qw, float qh, std::vector<Amara::Entity*>& found, bool includeUnbounded) {
+                queryStamp += 1;
+                if (includeUnbounded) {
+                    for (Amara::Entity* entity: unbounded) {
+                        found.push_back(entity);
+                    }
+                }
+
+                Amara::FloatRect area = { qx, qy, qw, qh };
+                Amara::IntRect range = toCellRange(area);
+                for (int cy = range.y; cy < range.y + range.height; cy++) {
+                    for (int cx = range.x; cx < range.x + range.width; cx++) {
+                        auto got = cells.find(toKey(cx, cy));
+                        if (got == cells.end()) continue;
+                        for (Amara::Entity* entity: got->second) {
+                            Amara::SpatialEntry& entry = entity->spatialEntry;
+                            if (entry.queryStamp == queryStamp) continue;
+                            entry.queryStamp = queryStamp;
+                            if (overlaps(entry.bounds, area)) found.push_back(entity);
+                        }
+                    }
+                }
+            }
+
+            void queryRadius(float qx, float qy, float radius, std::vector<Amara::Entity*>& found) {
+                std::vector<Amara::Entity*> candidates;
+                queryRect(qx - radius, qy - radius, radius*2, radius*2, candidates, false);
+                for (Amara::Entity* entity: candidates) {
+                    Amara::FloatRect& b = entity->spatialEntry.bounds;
+                    float nx = (qx < b.x) ? b.x : ((qx > b.x + b.width) ? b.x + b.width : qx);
+                    float ny = (qy < b.y) ? b.y : ((qy > b.y + b.height) ? b.y + b.height : qy);
+                    if ((nx - qx)*(nx - qx) + (ny - qy)*(ny - qy) <= radius*radius) {
+                        found.push_back(entity);
+                    }
+                }
+            }
+
+        private:
+            void insert(Amara::Entity* entity, bool bounded, Amara::FloatRect& bounds) {
+                Amara::SpatialEntry& entry = entity->spatialEntry;
+                entry.indexed = true;
+                entry.bounded = bounded;
+                if (!bounded) {
+                    unbounded.push_back(entity);
+                    return;
+                }
+                entry.bounds = bounds;
+                entry.cells = toCellRange(bounds);
+                for (int cy = entry.cells.y; cy < entry.cells.y + entry.cells.height; cy++) {
+                    for (int cx = entry.cells.x; cx < entry.cells.x + entry.cells.width; cx++) {
+                        cells[toKey(cx, cy)].push_back(entity);
+                    }
+                }
+            }
+
+            Amara::IntRect toCellRange(Amara::FloatRect& rect) {
+                Amara::IntRect range;
+                range.x = floor(rect.x / cellSize);
+                range.y = floor(rect.y / cellSize);
+                range.width = (int)floor((rect.x + rect.width) / cellSize) - range.x + 1;
+                range.height = (int)floor((rect.y + rect.height) / cellSize) - range.y + 1;
+                return range;
+            }
+
+            Sint64 toKey(int cx, int cy) {
+                return ((Sint64)cx << 32) ^ (Uint32)cy;
+            }
+
+            bool sameRange(Amara::IntRect& a, Amara::IntRect& b) {
+                return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+            }
+
+            bool overlaps(Amara::FloatRect& a, Amara::FloatRect& b) {
+                return a.x <= b.x + b.width && b.x <= a.x + a.width && a.y <= b.y + b.height && b.y <= a.y + a.height;
+            }
+
+            void removeFrom(std::vector<Amara::Entity*>& list, Amara::Entity* entity) {
+                for (size_t i = 0; i < list.size(); i++) {
+                    if (list[i] == entity) {
+                        list[i] = list.back();
+                        list.pop_back();
+                        return;
+                    }
+                }
+            }
+    };
+}
+
+#endif
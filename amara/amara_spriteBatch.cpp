@@ -0,0 +1,223 @@
+#pragma once
+#ifndef AMARA_SPRITEBATCH
+#define AMARA_SPRITEBATCH
+
+#include "amara.h"
+
+namespace Amara {
+    #if SDL_VERSION_ATLEAST(2, 0, 18)
+        typedef SDL_Vertex BatchVertex;
+    #else
+        // Same layout as SDL_Vertex, which older SDL doesn't have.
+        struct BatchVertex {
+            SDL_FPoint position;
+            SDL_Color color;
+            SDL_FPoint tex_coord;
+        };
+    #endif
+
+    // What SDL_RenderCopyExF would have been called with, kept for the per quad fallback.
+    struct BatchQuad {
+        SDL_Rect src;
+        SDL_FRect dest;
+        double angle = 0;
+        SDL_FPoint origin;
+        SDL_RendererFlip flip = SDL_FLIP_NONE;
+        SDL_Color color;
+    };
+
+    /*
+     * Collects textured quads drawn one after another with the same texture, blend mode and viewport,
+     * and sends them to SDL in one SDL_RenderGeometry call. SDL older than 2.0.18 gets a copy per quad,
+     * still without repeating the viewport and blend mode calls.
+     *
+     * Anything drawing through SDL directly has to flush() first so the order stays the same.
+     */
+    class SpriteBatch {
+        public:
+            SDL_Renderer* gRenderer = nullptr;
+            // Off draws every quad straight away.
+            bool enabled = true;
+
+            std::vector<Amara::BatchVertex> vertices;
+            std::vector<int> indices;
+            std::vector<Amara::BatchQuad> quads;
+
+            SDL_Texture* texture = nullptr;
+            SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+            SDL_Rect viewport;
+            bool hasViewport = false;
+            bool fullViewport = false;
+            float textureWidth = 1;
+            float textureHeight = 1;
+
+            // Counted since the last resetStats().
+            int numFlushes = 0;
+            int numQuads = 0;
+
+            SpriteBatch(SDL_Renderer* gRenderer) {
+                this->gRenderer = gRenderer;
+            }
+
+            void setViewport(const SDL_Rect& rect) {
+                if (hasViewport && !fullViewport && rect.x == viewport.x && rect.y == viewport.y && rect.w == viewport.w && rect.h == viewport.h) return;
+                flush();
+                viewport = rect;
+                hasViewport = true;
+                fullViewport = false;
+                SDL_RenderSetViewport(gRenderer, &viewport);
+            }
+
+            // Same as SDL_RenderSetViewport with NULL, the whole render target.
+            void setFullViewport() {
+                if (hasViewport && fullViewport) return;
+                flush();
+                hasViewport = true;
+                fullViewport = true;
+                SDL_RenderSetViewport(gRenderer, NULL);
+            }
+
+            void draw(SDL_Texture* tx, SDL_BlendMode blend, const SDL_Rect& src, const SDL_FRect& dest, double angle, const SDL_FPoint& origin, SDL_RendererFlip flip, SDL_Color color) {
+                if (tx == nullptr) return;
+                numQuads += 1;
+                if (!enabled) {
+                    if (texture) flush();
+                    Amara::BatchQuad quad = { src, dest, angle, origin, flip, color };
+                    drawQuad(tx, blend, quad);
+                    return;
+                }
+
+                if (tx != texture || blend != blendMode) {
+                    flush();
+                    texture = tx;
+                    blendMode = blend;
+                    int tw = 1, th = 1;
+                    SDL_QueryTexture(tx, NULL, NULL, &tw, &th);
+                    textureWidth = (tw > 0) ? tw : 1;
+                    textureHeight = (th > 0) ? th : 1;
+                }
+
+                #if SDL_VERSION_ATLEAST(2, 0, 18)
+                    addVertices(src, dest, angle, origin, flip, color);
+                #else
+                    Amara::BatchQuad quad = { src, dest, angle, origin, flip, color };
+                    quads.push_back(quad);
+                #endif
+            }
+
+            void draw(SDL_Texture* tx, SDL_BlendMode blend, const SDL_Rect& src, const SDL_FRect& dest, double angle, const SDL_FPoint& origin, SDL_RendererFlip flip, Uint8 alpha) {
+                SDL_Color color = { 255, 255, 255, alpha };
+                draw(tx, blend, src, dest, angle, origin, flip, color);
+            }
+
+            // Draws what's pending and forgets the viewport, since whoever flushed is about to change it.
+            void flush() {
+                hasViewport = false;
+                if (texture == nullptr) return;
+
+                #if SDL_VERSION_ATLEAST(2, 0, 18)
+                    if (!indices.empty()) {
+                        SDL_SetTextureBlendMode(texture, blendMode);
+                        SDL_SetTextureAlphaMod(texture, 255);
+                        SDL_SetTextureColorMod(texture, 255, 255, 255);
+                        SDL_RenderGeometry(gRenderer, texture, vertices.data(), vertices.size(), indices.data(), indices.size());
+                        numFlushes += 1;
+                    }
+                    vertices.clear();
+                    indices.clear();
+                #else
+                    if (!quads.empty()) {
+                        SDL_SetTextureBlendMode(texture, blendMode);
+                        Uint8 lastAlpha = 0;
+                        SDL_Color lastColor = { 255, 255, 255, 255 };
+                        bool first = true;
+                        for (Amara::BatchQuad& quad: quads) {
+                            if (first || quad.color.a != lastAlpha) {
+                                SDL_SetTextureAlphaMod(texture, quad.color.a);
+                                lastAlpha = quad.color.a;
+                            }
+                            if (first || quad.color.r != lastColor.r || quad.color.g != lastColor.g || quad.color.b != lastColor.b) {
+                                SDL_SetTextureColorMod(texture, quad.color.r, quad.color.g, quad.color.b);
+                                lastColor = quad.color;
+                            }
+                            first = false;
+                            SDL_RenderCopyExF(gRenderer, texture, &quad.src, &quad.dest, quad.angle, &quad.origin, quad.flip);
+                        }
+                        if (lastColor.r != 255 || lastColor.g != 255 || lastColor.b != 255) {
+                            SDL_SetTextureColorMod(texture, 255, 255, 255);
+                        }
+                        numFlushes += 1;
+                    }
+                    quads.clear();
+                #endif
+                texture = nullptr;
+            }
+
+            // Call before drawing through SDL directly or switching render targets.
+            static void flush(Amara::GameProperties* properties) {
+                if (properties->spriteBatch) properties->spriteBatch->flush();
+            }
+
+            void resetStats() {
+                numFlushes = 0;
+                numQuads = 0;
+            }
+
+        private:
+            void drawQuad(SDL_Texture* tx, SDL_BlendMode blend, Amara::BatchQuad& quad) {
+                SDL_SetTextureBlendMode(tx, blend);
+                SDL_SetTextureAlphaMod(tx, quad.color.a);
+                bool tinted = (quad.color.r != 255 || quad.color.g != 255 || quad.color.b != 255);
+                if (tinted) SDL_SetTextureColorMod(tx, quad.color.r, quad.color.g, quad.color.b);
+                SDL_RenderCopyExF(gRenderer, tx, &quad.src, &quad.dest, quad.angle, &quad.origin, quad.flip);
+                if (tinted) SDL_SetTextureColorMod(tx, 255, 255, 255);
+            }
+
+            // Corners rotated about dest + origin clockwise, the way SDL_RenderCopyExF does it.
+            void addVertices(const SDL_Rect& src, const SDL_FRect& dest, double angle, const SDL_FPoint& origin, SDL_RendererFlip flip, SDL_Color color) {
+                float u0 = src.x/textureWidth;
+                float v0 = src.y/textureHeight;
+                float u1 = (src.x + src.w)/textureWidth;
+                float v1 = (src.y + src.h)/textureHeight;
+                if (flip & SDL_FLIP_HORIZONTAL) std::swap(u0, u1);
+                if (flip & SDL_FLIP_VERTICAL) std::swap(v0, v1);
+
+                float cx = dest.x + origin.x;
+                float cy = dest.y + origin.y;
+                float left = -origin.x;
+                float top = -origin.y;
+                float right = dest.w - origin.x;
+                float bottom = dest.h - origin.y;
+
+                float c = 1, s = 0;
+                if (angle != 0) {
+                    double rad = angle*M_PI/180.0;
+                    c = cos(rad);
+                    s = sin(rad);
+                }
+
+                int base = vertices.size();
+                float xs[4] = { left, right, right, left };
+                float ys[4] = { top, top, bottom, bottom };
+                float us[4] = { u0, u1, u1, u0 };
+                float vs[4] = { v0, v0, v1, v1 };
+                for (int i = 0; i < 4; i++) {
+                    Amara::BatchVertex vertex;
+                    vertex.position.x = cx + xs[i]*c - ys[i]*s;
+                    vertex.position.y = cy + xs[i]*s + ys[i]*c;
+                    vertex.color = color;
+                    vertex.tex_coord.x = us[i];
+                    vertex.tex_coord.y = vs[i];
+                    vertices.push_back(vertex);
+                }
+                indices.push_back(base);
+                indices.push_back(base + 1);
+                indices.push_back(base + 2);
+                indices.push_back(base);
+                indices.push_back(base + 2);
+                indices.push_back(base + 3);
+            }
+    };
+}
+
+#endif
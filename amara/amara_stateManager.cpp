@@ -6,15 +6,22 @@
 
 namespace Amara {
     struct StateRecord {
-        std::string name;
+        Amara::StringId state = 0;
 		nlohmann::json data;
+        Amara::PropertyStore vars;
         int event = 0;
     };
 
+    /*
+     * States, bookmarks and jump flags are compared as hashed ids.
+     * The const char* and std::string overloads hash the name at runtime on every call,
+     * hot scripts should pass ids hashed at compile time, e.g. state("idle"_sid) or a constexpr Amara::StringId.
+     * currentState is an id, getStateName() gives back the name.
+     */
     class StateManager {
         public:
             Amara::GameProperties* properties = nullptr;
-            std::string currentState;
+            Amara::StringId currentState = 0;
 
             std::vector<StateRecord> stateRecords;
 
@@ -26,8 +33,10 @@ namespace Amara {
             bool skipEvent = false;
 
 			nlohmann::json data;
+            // Typed values for the current state, recorded and restored along with data.
+            Amara::PropertyStore vars;
 
-            std::string jumpFlag;
+            Amara::StringId jumpFlag = 0;
 
             StateManager() {
                 reset();
@@ -39,9 +48,9 @@ namespace Amara {
             }
 
             void reset() {
-                currentState.clear();
+                currentState = 0;
                 currentEvent = 1;
-                jumpFlag.clear();
+                jumpFlag = 0;
                 stateRecords.clear();
             }
 
@@ -53,62 +62,103 @@ namespace Amara {
                 return false;
             }
 
-            bool state(std::string key) {
-                if (currentState.empty()) {
+            bool state(Amara::StringId key) {
+                if (currentState == 0) {
                     currentState = key;
                 }
 
-                if (currentState.compare(key) == 0) {
+                if (currentState == key) {
                     eventLooker = 0;
                     return true;
                 }
 
                 return false;
             }
+            bool state(const char* key) {
+                if (currentState == 0) Amara::StringIds::intern(key);
+                return state(Amara::hashString(key));
+            }
+            bool state(const std::string& key) {
+                return state(key.c_str());
+            }
 
-            bool inState(std::string key) {
-                if (currentState.compare(key) == 0) {
-                    return true;
-                }
-                return false;
+            bool inState(Amara::StringId key) {
+                return currentState == key;
+            }
+            bool inState(const char* key) {
+                return inState(Amara::hashString(key));
+            }
+            bool inState(const std::string& key) {
+                return inState(key.c_str());
+            }
+
+            // Name of the current state, empty if it was only ever given as an id.
+            std::string getStateName() {
+                return Amara::StringIds::name(currentState);
             }
 
             bool start() {
-                if (currentState.empty()) {
+                if (currentState == 0) {
                     eventLooker = 0;
                     return true;
                 }
                 return false;
             }
 
-            void switchState(std::string key) {
-                if (!currentState.empty()) {
-                    Amara::StateRecord record = {currentState, data, currentEvent};
-                    stateRecords.push_back(record);
+            // The old state's data moves into its record rather than being copied.
+            void switchState(Amara::StringId key) {
+                if (currentState != 0) {
+                    stateRecords.emplace_back();
+                    Amara::StateRecord& record = stateRecords.back();
+                    record.state = currentState;
+                    record.data = std::move(data);
+                    record.vars = std::move(vars);
+                    record.event = currentEvent;
                 }
 
                 currentState = key;
                 currentEvent = 1;
-				data.clear();
+				data = nlohmann::json();
+                vars.clear();
+            }
+            void switchState(const char* key) {
+                Amara::StringId id = Amara::hashString(key);
+                // Only names not seen before are copied in, so switching back and forth doesn't allocate.
+                if (!Amara::StringIds::isKnown(id)) Amara::StringIds::intern(key);
+                switchState(id);
+            }
+            void switchState(const std::string& key) {
+                switchState(key.c_str());
             }
 
-            bool switchStateEvt(std::string key) {
+            bool switchStateEvt(Amara::StringId key) {
+                if (once()) {
+                    switchState(key);
+                    return true;
+                }
+                return false;
+            }
+            bool switchStateEvt(const char* key) {
                 if (once()) {
                     switchState(key);
                     return true;
                 }
                 return false;
             }
+            bool switchStateEvt(const std::string& key) {
+                return switchStateEvt(key.c_str());
+            }
 
             void returnState() {
                 if (stateRecords.empty()) {
                     reset();
                 }
                 else {
-                    Amara::StateRecord record = stateRecords.back();
-                    currentState = record.name;
+                    Amara::StateRecord& record = stateRecords.back();
+                    currentState = record.state;
                     currentEvent = record.event;
-					data = record.data;
+					data = std::move(record.data);
+                    vars = std::move(record.vars);
                     stateRecords.pop_back();
                 }
             }
@@ -204,15 +254,15 @@ namespace Amara {
                 return ret;
             }
 
-            bool bookmark(std::string flag) {
+            bool bookmark(Amara::StringId flag) {
                 bool toReturn = false;
 
                 if (once()) {
                     toReturn = true;
                 }
                 else {
-                    if (jumpFlag.compare(flag) == 0) {
-                        jumpFlag.clear();
+                    if (jumpFlag == flag) {
+                        jumpFlag = 0;
                         currentEvent = eventLooker;
                         nextEvt();
                         toReturn = true;
@@ -221,18 +271,36 @@ namespace Amara {
 
                 return toReturn;
             }
+            bool bookmark(const char* flag) {
+                return bookmark(Amara::hashString(flag));
+            }
+            bool bookmark(const std::string& flag) {
+                return bookmark(flag.c_str());
+            }
 
-            void jump(std::string flag) {
+            void jump(Amara::StringId flag) {
                 jumpFlag = flag;
             }
+            void jump(const char* flag) {
+                jump(Amara::hashString(flag));
+            }
+            void jump(const std::string& flag) {
+                jump(flag.c_str());
+            }
 
-            bool jumpEvt(std::string flag) {
+            bool jumpEvt(Amara::StringId flag) {
                 if (evt()) {
                     jump(flag);
                     return true;
                 }
                 return false;
             }
+            bool jumpEvt(const char* flag) {
+                return jumpEvt(Amara::hashString(flag));
+            }
+            bool jumpEvt(const std::string& flag) {
+                return jumpEvt(flag.c_str());
+            }
     };
 }
 
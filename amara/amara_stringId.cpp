@@ -0,0 +1,79 @@
+#pragma once
+#ifndef AMARA_STRINGID
+#define AMARA_STRINGID
+
+#include "amara.h"
+
+namespace Amara {
+    typedef Uint64 StringId;
+
+    /*
+     * 64 bit FNV-1a of a string, constexpr so ids written as literals cost nothing at runtime.
+     * e.g. constexpr Amara::StringId ENEMY = Amara::hashString("enemy");
+     */
+    constexpr Amara::StringId hashString(const char* str) {
+        Amara::StringId hash = 14695981039346656037ULL;
+        while (*str) {
+            hash ^= (unsigned char)*str;
+            hash *= 1099511628211ULL;
+            str += 1;
+        }
+        return hash;
+    }
+
+    inline Amara::StringId hashString(const std::string& str) {
+        return hashString(str.c_str());
+    }
+
+    #if defined(__cpp_consteval)
+        #define AMARA_CONSTEVAL consteval
+    #else
+        #define AMARA_CONSTEVAL constexpr
+    #endif
+
+    /*
+     * "enemy"_sid after using namespace Amara::literals, hashed while compiling.
+     * Guaranteed with C++20, C++17 builds leave the folding to the optimizer.
+     */
+    namespace literals {
+        AMARA_CONSTEVAL Amara::StringId operator""_sid(const char* str, size_t) {
+            return Amara::hashString(str);
+        }
+    }
+
+    // Remembers the names behind runtime ids, for debugging and to catch collisions.
+    class StringIds {
+        public:
+            static Amara::StringId intern(const std::string& name) {
+                Amara::StringId id = hashString(name);
+                std::unordered_map<Amara::StringId, std::string>& names = getNames();
+                auto got = names.find(id);
+                if (got == names.end()) {
+                    names[id] = name;
+                }
+                else if (got->second.compare(name) != 0) {
+                    std::cout << "StringIds: \"" << name << "\" collides with \"" << got->second << "\"" << std::endl;
+                }
+                return id;
+            }
+
+            static bool isKnown(Amara::StringId id) {
+                return getNames().find(id) != getNames().end();
+            }
+
+            static std::string name(Amara::StringId id) {
+                std::unordered_map<Amara::StringId, std::string>& names = getNames();
+                auto got = names.find(id);
+                if (got == names.end()) return "";
+                return got->second;
+            }
+
+        private:
+            static std::unordered_map<Amara::StringId, std::string>& getNames() {
+                static std::unordered_map<Amara::StringId, std::string> names;
+                return names;
+            }
+    };
+}
+
+#endif
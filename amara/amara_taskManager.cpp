@@ -6,15 +6,41 @@
 
 namespace Amara {
     class Entity;
+    class PhysicsBase;
     class SceneTransitionBase;
-    
+
+    /*
+     * Owns deletion of destroyed objects. Queues are drained in order at the end of each frame
+     * within a time and count budget, so tearing down a big scene is spread over several frames.
+     * run() and flush() are defined in amara_game.cpp, where every queued type is complete.
+     */
     class TaskManager {
         public:
             Amara::GameProperties* properties = nullptr;
             std::vector<Amara::Entity*> entityDeletionQueue;
+            std::vector<Amara::PhysicsBase*> physicsDeletionQueue;
             std::vector<Amara::SceneTransitionBase*> transitionDeletionQueue;
             std::vector<void*> objectDeletionQueue;
 
+            // Parents that lost children since the last run, compacted before anything is deleted.
+            std::vector<Amara::Entity*> detachQueue;
+
+            // How far into each queue the previous frames got.
+            size_t entityIndex = 0;
+            size_t physicsIndex = 0;
+            size_t transitionIndex = 0;
+            size_t objectIndex = 0;
+
+            // Milliseconds and number of deletions allowed per frame, 0 means no limit.
+            double timeBudget = 2;
+            int countBudget = 0;
+            // The time budget always lets at least this many through so the queues keep moving.
+            int minDeletions = 32;
+
+            int deletedLastFrame = 0;
+            size_t teardownSize = 0;
+            int teardownFrames = 0;
+
             TaskManager(Amara::GameProperties* gameProperties) {
                 properties = gameProperties;
             }
@@ -23,6 +49,15 @@ namespace Amara {
                 entityDeletionQueue.push_back(obj);
             }
 
+            void queueDeletion(Amara::Entity* obj, Amara::Entity* formerParent) {
+                entityDeletionQueue.push_back(obj);
+                if (formerParent != nullptr) detachQueue.push_back(formerParent);
+            }
+
+            void queueDeletion(Amara::PhysicsBase* body) {
+                physicsDeletionQueue.push_back(body);
+            }
+
             void queueDeletion(Amara::SceneTransitionBase* transition) {
                 transitionDeletionQueue.push_back(transition);
             }
@@ -34,6 +69,9 @@ namespace Amara {
             std::vector<Amara::Entity*>& getEntityQueue() {
                 return entityDeletionQueue;
             }
+            std::vector<Amara::PhysicsBase*>& getPhysicsQueue() {
+                return physicsDeletionQueue;
+            }
             std::vector<Amara::SceneTransitionBase*>& getTransitionQueue() {
                 return transitionDeletionQueue;
             }
@@ -41,8 +79,54 @@ namespace Amara {
                 return objectDeletionQueue;
             }
 
-            void run() {}
+            void setBudget(double gTimeBudget, int gCountBudget) {
+                timeBudget = gTimeBudget;
+                countBudget = gCountBudget;
+            }
+            void setBudget(double gTimeBudget) {
+                setBudget(gTimeBudget, 0);
+            }
+            void removeBudget() {
+                setBudget(0, 0);
+            }
+
+            // Number of objects still waiting to be deleted.
+            size_t getQueueDepth() {
+                return (entityDeletionQueue.size() - entityIndex)
+                    + (physicsDeletionQueue.size() - physicsIndex)
+                    + (transitionDeletionQueue.size() - transitionIndex)
+                    + (objectDeletionQueue.size() - objectIndex);
+            }
+
+            void run();
+            // Deletes everything queued right away, ignoring the budget.
+            void flush();
+
+        private:
+            Uint64 budgetEnd = 0;
+
+            bool withinBudget() {
+                if (countBudget > 0 && deletedLastFrame >= countBudget) return false;
+                if (timeBudget > 0 && deletedLastFrame >= minDeletions && SDL_GetPerformanceCounter() >= budgetEnd) return false;
+                return true;
+            }
+
+            template <class T>
+            void drain(std::vector<T*>& queue, size_t& index) {
+                while (index < queue.size() && withinBudget()) {
+                    T* obj = queue[index];
+                    index += 1;
+                    delete obj;
+                    deletedLastFrame += 1;
+                }
+                if (index >= queue.size()) {
+                    queue.clear();
+                    index = 0;
+                }
+            }
+
+            void detachQueued();
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,227 @@
+#pragma once
+#ifndef AMARA_TEXTUREATLAS
+#define AMARA_TEXTUREATLAS
+
+#include "amara.h"
+
+namespace Amara {
+    // A stretch of the skyline, everything below y from x to x + width is taken.
+    struct SkylineNode {
+        int x = 0;
+        int y = 0;
+        int width = 0;
+    };
+
+    /*
+     * Skyline bottom-left rectangle packer. Keeps the top edge of what's been placed so far
+     * and puts each rectangle where it ends up lowest, picking the narrower spot on a tie.
+     */
+    class SkylinePacker {
+        public:
+            int width = 0;
+            int height = 0;
+            std::vector<Amara::SkylineNode> skyline;
+
+            SkylinePacker() {}
+            SkylinePacker(int gWidth, int gHeight) {
+                reset(gWidth, gHeight);
+            }
+
+            void reset(int gWidth, int gHeight) {
+                width = gWidth;
+                height = gHeight;
+                skyline.clear();
+                Amara::SkylineNode node;
+                node.width = width;
+                skyline.push_back(node);
+            }
+
+            bool insert(int w, int h, int& outX, int& outY) {
+                int bestIndex = -1;
+                int bestTop = 0;
+                int bestWidth = 0;
+                int bestY = 0;
+                for (size_t i = 0; i < skyline.size(); i++) {
+                    int y;
+                    if (!fits(i, w, h, y)) continue;
+                    if (bestIndex == -1 || y + h < bestTop || (y + h == bestTop && skyline[i].width < bestWidth)) {
+                        bestIndex = i;
+                        bestTop = y + h;
+                        bestWidth = skyline[i].width;
+                        bestY = y;
+                    }
+                }
+                if (bestIndex == -1) return false;
+
+                outX = skyline[bestIndex].x;
+                outY = bestY;
+                place(bestIndex, outX, bestY + h, w);
+                return true;
+            }
+
+        private:
+            // Where a w by h rectangle would rest with its left edge on node index.
+            bool fits(size_t index, int w, int h, int& y) {
+                if (skyline[index].x + w > width) return false;
+                y = skyline[index].y;
+                int remaining = w;
+                for (size_t i = index; remaining > 0 && i < skyline.size(); i++) {
+                    if (skyline[i].y > y) y = skyline[i].y;
+                    if (y + h > height) return false;
+                    remaining -= skyline[i].width;
+                }
+                return true;
+            }
+
+            void place(size_t index, int x, int top, int w) {
+                Amara::SkylineNode node;
+                node.x = x;
+                node.y = top;
+                node.width = w;
+                skyline.insert(skyline.begin() + index, node);
+
+                // Trim the nodes the new one now covers.
+                for (size_t i = index + 1; i < skyline.size();) {
+                    int prevEnd = skyline[i - 1].x + skyline[i - 1].width;
+                    if (skyline[i].x >= prevEnd) break;
+                    int shrink = prevEnd - skyline[i].x;
+                    skyline[i].x += shrink;
+                    skyline[i].width -= shrink;
+                    if (skyline[i].width > 0) break;
+                    skyline.erase(skyline.begin() + i);
+                }
+
+                for (size_t i = 0; i + 1 < skyline.size();) {
+                    if (skyline[i].y == skyline[i + 1].y) {
+                        skyline[i].width += skyline[i + 1].width;
+                        skyline.erase(skyline.begin() + i + 1);
+                    }
+                    else i++;
+                }
+            }
+    };
+
+    struct AtlasPage {
+        SDL_Texture* texture = nullptr;
+        Amara::SkylinePacker packer;
+        int numRegions = 0;
+    };
+
+    /*
+     * Packs loaded images into a few large textures so whatever draws them can keep batching
+     * instead of switching textures. Assets get an ImageTexture pointing at their region of a page.
+     *
+     * Regions aren't freed when their asset is removed, the space comes back when the atlas is removed.
+     */
+    class TextureAtlas {
+        public:
+            SDL_Renderer* gRenderer = nullptr;
+            std::string key;
+
+            int pageWidth = 2048;
+            int pageHeight = 2048;
+            // Empty pixels kept between regions so filtering doesn't bleed neighbours in.
+            int padding = 1;
+
+            std::vector<Amara::AtlasPage*> pages;
+
+            TextureAtlas(SDL_Renderer* renderer, std::string gKey, int gPageWidth, int gPageHeight) {
+                gRenderer = renderer;
+                key = gKey;
+                pageWidth = gPageWidth;
+                pageHeight = gPageHeight;
+
+                SDL_RendererInfo info;
+                if (SDL_GetRendererInfo(gRenderer, &info) == 0) {
+                    if (info.max_texture_width > 0 && pageWidth > info.max_texture_width) pageWidth = info.max_texture_width;
+                    if (info.max_texture_height > 0 && pageHeight > info.max_texture_height) pageHeight = info.max_texture_height;
+                }
+            }
+
+            TextureAtlas(SDL_Renderer* renderer, std::string gKey): TextureAtlas(renderer, gKey, 2048, 2048) {}
+
+            /*
+             * Copies the surface into the first page with room for it, starting a new page if none has.
+             * Returns false if it's bigger than a page, the caller should give it a texture of its own.
+             */
+            bool pack(SDL_Surface* surface, SDL_Texture*& outTexture, SDL_Rect& outRegion) {
+                if (surface == nullptr) return false;
+                int w = surface->w;
+                int h = surface->h;
+                if (w + padding > pageWidth || h + padding > pageHeight) return false;
+
+                Amara::AtlasPage* page = nullptr;
+                int x = 0, y = 0;
+                for (Amara::AtlasPage* existing: pages) {
+                    if (existing->packer.insert(w + padding, h + padding, x, y)) {
+                        page = existing;
+                        break;
+                    }
+                }
+                if (page == nullptr) {
+                    page = newPage();
+                    if (page == nullptr) return false;
+                    if (!page->packer.insert(w + padding, h + padding, x, y)) return false;
+                }
+
+                SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+                if (converted == nullptr) {
+                    std::cout << "TextureAtlas \"" << key << "\": Unable to convert surface. SDL Error: " << SDL_GetError() << std::endl;
+                    return false;
+                }
+                outRegion = { x, y, w, h };
+                SDL_UpdateTexture(page->texture, &outRegion, converted->pixels, converted->pitch);
+                SDL_FreeSurface(converted);
+
+                page->numRegions += 1;
+                outTexture = page->texture;
+                return true;
+            }
+
+            int numPages() {
+                return pages.size();
+            }
+
+            bool hasPage(SDL_Texture* texture) {
+                for (Amara::AtlasPage* page: pages) {
+                    if (page->texture == texture) return true;
+                }
+                return false;
+            }
+
+            // Atlases belong to the Loader, go through Loader::removeAtlas() so packed assets are removed too.
+            void clear() {
+                for (Amara::AtlasPage* page: pages) {
+                    SDL_DestroyTexture(page->texture);
+                    delete page;
+                }
+                pages.clear();
+            }
+
+            ~TextureAtlas() {
+                clear();
+            }
+
+        private:
+            Amara::AtlasPage* newPage() {
+                SDL_Texture* texture = SDL_CreateTexture(gRenderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, pageWidth, pageHeight);
+                if (texture == nullptr) {
+                    std::cout << "TextureAtlas \"" << key << "\": Unable to create page. SDL Error: " << SDL_GetError() << std::endl;
+                    return nullptr;
+                }
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+                // Static textures start out undefined, so the padding has to be cleared by hand.
+                std::vector<Uint32> blank(pageWidth*pageHeight, 0);
+                SDL_UpdateTexture(texture, NULL, blank.data(), pageWidth*sizeof(Uint32));
+
+                Amara::AtlasPage* page = new Amara::AtlasPage();
+                page->texture = texture;
+                page->packer.reset(pageWidth, pageHeight);
+                pages.push_back(page);
+                return page;
+            }
+    };
+}
+
+#endif
@@ -7,7 +7,30 @@ namespace Amara {
     const unsigned long TILED_FLIPPEDHORIZONTALLY = 0x80000000;
     const unsigned long TILED_FLIPPEDVERTICALLY = 0x40000000;
     const unsigned long TILED_FLIPPEDANTIDIAGONALLY = 0x20000000;
+    const unsigned long TILED_FLIPFLAGS = TILED_FLIPPEDHORIZONTALLY | TILED_FLIPPEDVERTICALLY | TILED_FLIPPEDANTIDIAGONALLY;
 
+    /*
+     * Layers store each tile as a 32 bit GID, the tile id plus one with Tiled's flip flags in the top bits.
+     * 0 is an empty tile, so are negative ids.
+     */
+    Uint32 packTile(int id, bool fhorizontal, bool fvertical, bool fdiagonal) {
+        if (id < 0) return 0;
+        Uint32 gid = ((Uint32)id + 1) & ~TILED_FLIPFLAGS;
+        if (fhorizontal) gid |= TILED_FLIPPEDHORIZONTALLY;
+        if (fvertical) gid |= TILED_FLIPPEDVERTICALLY;
+        if (fdiagonal) gid |= TILED_FLIPPEDANTIDIAGONALLY;
+        return gid;
+    }
+
+    Uint32 packTile(int id) {
+        return packTile(id, false, false, false);
+    }
+
+    int unpackTileId(Uint32 gid) {
+        return (int)(gid & ~TILED_FLIPFLAGS) - 1;
+    }
+
+    // A copy of one cell of a layer, changing it doesn't change the layer.
     struct Tile {
         int id = -1;
         int x = 0;
@@ -17,13 +40,21 @@ namespace Amara {
         bool fvertical = false;
         bool fdiagonal = false;
 
-        float tileWidth = 0;
-        float tileHeight = 0;
-        int widthInPixels = 0;
-        int heightInPixels = 0;
+        Tile() {}
+
+        Tile(Uint32 gid, int gx, int gy) {
+            id = unpackTileId(gid);
+            x = gx;
+            y = gy;
+            fhorizontal = (gid & TILED_FLIPPEDHORIZONTALLY) != 0;
+            fvertical = (gid & TILED_FLIPPEDVERTICALLY) != 0;
+            fdiagonal = (gid & TILED_FLIPPEDANTIDIAGONALLY) != 0;
+        }
 
-        bool animated  = false;
+        Uint32 pack() const {
+            return packTile(id, fhorizontal, fvertical, fdiagonal);
+        }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
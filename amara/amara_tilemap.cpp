@@ -5,6 +5,13 @@
 #include "amara.h"
 
 namespace Amara {
+    enum WallCellFlag {
+        // A wall layer has a tile here.
+        WALLCELL_TILE = 1,
+        // A wall layer has a tile here that isn't in wallTypes, so it blocks every direction.
+        WALLCELL_SOLID = 2
+    };
+
     class Tilemap: public Amara::Actor, public Amara::WallFinder {
         public:
             std::string textureKey;
@@ -24,8 +31,20 @@ namespace Amara {
 
             std::unordered_map<std::string, Amara::TilemapLayer*> layers;
             std::vector<Amara::TilemapLayer*> walls;
+            // Change through setWallId(), or call refreshWalls() after editing it directly.
             std::unordered_map<int, Amara::Direction> wallTypes;
 
+            /*
+             * What the wall layers add up to for each cell, so wall checks don't visit every layer.
+             * wallCells holds WallCellFlags, wallDirections the directions blocked by tiles in wallTypes.
+             * Rebuilt when the walls or wallTypes change, updated a cell at a time as wall tiles are set.
+             */
+            std::vector<Uint8> wallCells;
+            std::vector<Uint8> wallDirections;
+            int wallGridWidth = 0;
+            int wallGridHeight = 0;
+            bool wallsStale = true;
+
             Tilemap(): Amara::Actor() {}
 
             Tilemap(float gx, float gy, std::string gTextureKey) {
@@ -119,7 +138,7 @@ namespace Amara {
                 widthInPixels = gLayer->tileWidth*gLayer->width;
                 heightInPixels = gLayer->tileHeight*gLayer->height;
 
-                gLayer->id = gid;
+                gLayer->setId(gid);
                 layers[gid] = gLayer;
                 return gLayer;
             }
@@ -128,7 +147,7 @@ namespace Amara {
                 Amara::TilemapLayer* newLayer;
                 ((Amara::Entity*)scene)->add(newLayer = new Amara::TilemapLayer(mapWidth, mapHeight, tileWidth, tileHeight));
 
-                newLayer->id = layerKey;
+                newLayer->setId(layerKey);
                 newLayer->setTexture(textureKey);
                 newLayer->setTilemap(this, this);
 
@@ -149,7 +168,7 @@ namespace Amara {
                 if (newLayer->width > width) width = newLayer->width;
                 if (newLayer->height > height) height = newLayer->height;
 
-                newLayer->id = layerKey;
+                newLayer->setId(layerKey);
 
                 newLayer->x = x;
                 newLayer->y = y;
@@ -175,7 +194,7 @@ namespace Amara {
                     newLayer->setTexture(textureKey);
                 }
                 
-                newLayer->id = layerKey;
+                newLayer->setId(layerKey);
 
                 newLayer->x = x;
                 newLayer->y = y;
@@ -260,18 +279,51 @@ namespace Amara {
                         walls.push_back(layer);
                     }
                 }
+                refreshWalls();
                 return walls;
             }
 
-            virtual bool isWall(int gx, int gy) {
-                Amara::Tile tile;
+            void refreshWalls() {
+                wallsStale = true;
+            }
+
+            bool isWallLayer(Amara::TilemapLayer* layer) {
+                return std::find(walls.begin(), walls.end(), layer) != walls.end();
+            }
+
+            // Called by a layer when one of its tiles is set.
+            void updateWallAt(Amara::TilemapLayer* layer, int gx, int gy) {
+                if (wallsStale || !isWallLayer(layer)) return;
+                if (gx < 0 || gy < 0 || gx >= wallGridWidth || gy >= wallGridHeight) return;
+                updateWallCell(gx, gy);
+            }
+
+            void buildWalls() {
+                wallsStale = false;
+                wallGridWidth = 0;
+                wallGridHeight = 0;
                 for (Amara::TilemapLayer* layer: walls) {
-                    tile = layer->getTileAt(gx, gy);
-                    if (tile.id >= 0) {
-                        return true;
+                    if (layer->width > wallGridWidth) wallGridWidth = layer->width;
+                    if (layer->height > wallGridHeight) wallGridHeight = layer->height;
+                }
+                wallCells.assign(wallGridWidth*wallGridHeight, 0);
+                wallDirections.assign(wallGridWidth*wallGridHeight, 0);
+                for (int gy = 0; gy < wallGridHeight; gy++) {
+                    for (int gx = 0; gx < wallGridWidth; gx++) {
+                        updateWallCell(gx, gy);
                     }
                 }
-                return false;
+            }
+
+            // Out of range coordinates are clamped, like TilemapLayer::getTileAt().
+            virtual bool isWall(int gx, int gy) {
+                if (wallsStale) buildWalls();
+                if (wallCells.empty()) return false;
+                if (gx < 0) gx = 0;
+                if (gy < 0) gy = 0;
+                if (gx >= wallGridWidth) gx = wallGridWidth - 1;
+                if (gy >= wallGridHeight) gy = wallGridHeight - 1;
+                return (wallCells[gy*wallGridWidth + gx] & WALLCELL_TILE) != 0;
             }
 
             bool isWallAtXY(int gx, int gy) {
@@ -289,23 +341,16 @@ namespace Amara {
                 if (gx < 0 || gy < 0) return (offMapIsWall) ? true : false;
                 if (gx >= width || gy >= height) return (offMapIsWall) ? true : false;
 
-                Amara::Tile tile;
-                for (Amara::TilemapLayer* layer: walls) {
-                    tile = layer->getTileAt(gx, gy);
-                    if (wallTypes.find(tile.id) != wallTypes.end()) {
-                        if (wallTypes[tile.id] == dir) {
-                            return true;
-                        }
-                    }
-                    else if (tile.id >= 0) {
-                        return true;
-                    }
-                }
-                return false;
+                if (wallsStale) buildWalls();
+                if (gx >= wallGridWidth || gy >= wallGridHeight) return false;
+                int index = gy*wallGridWidth + gx;
+                if (wallCells[index] & WALLCELL_SOLID) return true;
+                return (wallDirections[index] & dir) != 0;
             }
             
             void setWallId(int id, Amara::Direction dir) {
                 wallTypes[id] = dir;
+                refreshWalls();
             }
 
             void run() {
@@ -347,7 +392,35 @@ namespace Amara {
             float getMidTileY(int ty) {
                 return (ty + 0.5) * tileHeight; 
             }
+
+        private:
+            void updateWallCell(int gx, int gy) {
+                Uint8 flags = 0;
+                Uint8 directions = 0;
+                for (Amara::TilemapLayer* layer: walls) {
+                    if (gx >= layer->width || gy >= layer->height) continue;
+                    int id = layer->getTileIdAt(gx, gy);
+                    if (id < 0) continue;
+                    flags |= WALLCELL_TILE;
+                    std::unordered_map<int, Amara::Direction>::iterator got = wallTypes.find(id);
+                    if (got != wallTypes.end()) directions |= got->second;
+                    else flags |= WALLCELL_SOLID;
+                }
+                int index = gy*wallGridWidth + gx;
+                wallCells[index] = flags;
+                wallDirections[index] = directions;
+            }
     };
+
+    void TilemapLayer::notifyTilemap(int index) {
+        if (tilemap == nullptr) return;
+        if (index < 0) {
+            if (tilemap->isWallLayer(this)) tilemap->refreshWalls();
+        }
+        else if (width > 0) {
+            tilemap->updateWallAt(this, index % width, index / width);
+        }
+    }
 }
 
 #endif
\ No newline at end of file
@@ -18,11 +18,25 @@ namespace Amara {
         return tileId;
     }
 
+    enum TilemapDrawMode {
+        // Tiles are cached in chunk textures, see TilemapLayer::chunks.
+        TILEMAP_DRAW_CHUNKS,
+        // Visible tiles are drawn straight to the current target every frame, nothing is cached.
+        TILEMAP_DRAW_DIRECT
+    };
+
+    // A square of tiles pre-rendered into its own texture, redrawn only after one of its tiles changes.
+    struct TilemapChunk {
+        SDL_Texture* texture = nullptr;
+        bool dirty = true;
+        // The layer's draw count when the chunk was last on screen.
+        Uint64 lastDrawn = 0;
+    };
+
     class TilemapLayer: public Amara::Actor {
         public:
             SDL_Renderer* gRenderer = nullptr;
             Amara::ImageTexture* texture = nullptr;
-            SDL_Texture* drawTexture = nullptr;
             std::string textureKey;
 
             bool givenTiledJson = false;
@@ -31,7 +45,8 @@ namespace Amara {
 
             std::string tiledLayerKey;
 
-            std::vector<Amara::Tile> tiles;
+            // One packed GID per cell, see packTile().
+            std::vector<Uint32> tiles;
 
             Amara::Tilemap* tilemap = nullptr;
             Amara::Entity* tilemapEntity = nullptr;
@@ -66,7 +81,42 @@ namespace Amara {
 
             bool extruded = false;
 
-            std::unordered_map<int, Amara::TileAnimation> animations;
+            std::vector<Amara::TileAnimation> animations;
+
+            /*
+             * Flat tables refreshed once a tick so drawing a tile is two array reads.
+             * tileFrames maps a tile id to the frame drawn for it, which moves along for animated ids.
+             * frameRects is the source rect of every frame in the texture.
+             */
+            std::vector<int> tileFrames;
+            std::vector<SDL_Rect> frameRects;
+            std::vector<Uint8> animatedIds;
+            bool frameTablesStale = true;
+            Amara::ImageTexture* framesTexture = nullptr;
+
+            // Indices of the tiles showing an animated id, so a frame change only redraws their chunks.
+            std::vector<int> animatedTiles;
+            bool animatedTilesStale = true;
+
+            /*
+             * The layer is drawn as chunks of chunkSize by chunkSize tiles, each cached in a texture.
+             * Tiles written straight into tiles need refreshTileAt() or refreshTiles() to show up.
+             */
+            std::vector<Amara::TilemapChunk> chunks;
+            int chunkSize = 16;
+            int chunksWide = 0;
+            int chunksHigh = 0;
+            // The angle the chunks were drawn at, tiles are rotated inside their chunk.
+            float chunkAngle = 0;
+
+            Amara::TilemapDrawMode drawMode = TILEMAP_DRAW_CHUNKS;
+            /*
+             * Chunk textures kept at once. Past this the ones off screen longest are freed,
+             * so memory follows the size of the view rather than the size of the map.
+             */
+            int maxChunkTextures = 64;
+            int numChunkTextures = 0;
+            Uint64 drawCount = 0;
 
             TilemapLayer(float gw, float gh, float tw, float th): Amara::Actor() {
                 width = gw;
@@ -79,13 +129,7 @@ namespace Amara {
                 imageWidth = widthInPixels;
                 imageHeight = heightInPixels;
 
-                Amara::Tile tile;
-                tiles.resize(width*height, tile);
-                for (int t = 0; t < tiles.size(); t++) {
-                    Tile& tile = tiles[t];
-                    tile.x = (t % width);
-                    tile.y = floor(((float)t) / (float)width);
-                }
+                tiles.resize(width*height, 0);
             }
 
             TilemapLayer(std::string gTextureKey, std::string gTiledJsonKey) {
@@ -108,7 +152,7 @@ namespace Amara {
                     setTiledJson(tiledJsonKey);
                 }
                 else {
-                    createDrawTexture();
+                    createChunks();
                 }
                 if (!tiledLayerKey.empty()) {
                     setupTiledLayer(tiledLayerKey);
@@ -129,6 +173,12 @@ namespace Amara {
                 if (config.find("extruded") != config.end()) {
                     extruded = config["extruded"];
                 }
+                if (config.find("chunkSize") != config.end()) {
+                    setChunkSize(config["chunkSize"]);
+                }
+                if (config.find("drawDirect") != config.end()) {
+                    setDrawMode(config["drawDirect"] ? TILEMAP_DRAW_DIRECT : TILEMAP_DRAW_CHUNKS);
+                }
             }
 
             void setupLayer(std::string gTextureKey, std::string gTiledJsonKey, std::string gLayerKey) {
@@ -162,21 +212,21 @@ namespace Amara {
                         imageWidth = widthInPixels;
                         imageHeight = heightInPixels;
 
-                        Amara::Tile tile;
-                        tiles.resize(width*height, tile);
-                        createDrawTexture();
+                        tiles.assign(width*height, 0);
+                        createChunks();
+                        notifyTilemap(-1);
 
                         animations.clear();
                         if (tiledJson.find("tilesets") != tiledJson.end()) {
                             for (nlohmann::json& tilesetJson: tiledJson["tilesets"]) {
                                 if (tilesetJson.find("tiles") != tilesetJson.end()) {
                                     for (nlohmann::json& animData: tilesetJson["tiles"]) {
-                                        int tileId = animData["id"];
-                                        animations.insert(std::make_pair(tileId, Amara::TileAnimation(properties, animData)));
+                                        animations.push_back(Amara::TileAnimation(properties, animData));
                                     }
                                 }
                             }
                         }
+                        frameTablesStale = true;
                     }
                     else {
                         std::cout << "JSON with key: \"" << tiledJsonKey << "\" was not found." << std::endl;
@@ -191,10 +241,6 @@ namespace Amara {
                 unsigned long tileId;
                 int firstgid = tiledJson["tilesets"][0]["firstgid"];
 
-                bool fhorizontal;
-                bool fvertical;
-                bool fdiagonal;
-
                 int numLayers = layers.size();
                 for (size_t l = 0; l < numLayers; l++) {
                     if (tiledLayerKey.compare(layers[l]["name"]) != 0) continue;
@@ -208,16 +254,12 @@ namespace Amara {
                         bool fvertical = (tileId & Amara::TILED_FLIPPEDVERTICALLY) != 0;
                         bool fdiagonal = (tileId & Amara::TILED_FLIPPEDANTIDIAGONALLY) != 0;
                         
-                        Amara::Tile& tile = tiles.at(t);
-                        tileId = tileId & ~(Amara::TILED_FLIPPEDHORIZONTALLY | Amara::TILED_FLIPPEDVERTICALLY | Amara::TILED_FLIPPEDANTIDIAGONALLY);
-                        tile.id = (int)(tileId - firstgid);
-                        tile.x = (t % width);
-                        tile.y = floor(((float)t) / (float)width);
-                        tile.fhorizontal = fhorizontal;
-                        tile.fvertical = fvertical;
-                        tile.fdiagonal = fdiagonal;
+                        tileId = tileId & ~Amara::TILED_FLIPFLAGS;
+                        tiles.at(t) = packTile((int)(tileId - firstgid), fhorizontal, fvertical, fdiagonal);
                     }
                 }
+                refreshTiles();
+                notifyTilemap(-1);
             }
 
             void setupTiledLayer(std::string tiledJsonKey, std::string gLayerKey) {
@@ -227,8 +269,10 @@ namespace Amara {
 
             void setupTiledLayer(std::vector<int> gTiles) {
                 for (size_t j = 0; j < gTiles.size(); j++) {
-                    tiles.at(j).id = gTiles.at(j);
+                    tiles.at(j) = packTile(gTiles.at(j));
                 }
+                refreshTiles();
+                notifyTilemap(-1);
             }
 
             bool setTexture(std::string gTextureKey) {
@@ -236,6 +280,8 @@ namespace Amara {
                 texture = (Amara::ImageTexture*)(load->get(gTextureKey));
                 if (texture != nullptr) {
                     textureKey = texture->key;
+                    frameTablesStale = true;
+                    refreshTiles();
                     return true;
                 }
                 else {
@@ -244,26 +290,35 @@ namespace Amara {
                 return false;
             }
 
-            int getTileIdAt(int gx, int gy) {
-                return getTileAt(gx, gy).id;
-            }
-
-            Amara::Tile& getTileAt(int gx, int gy) {
+            // Out of range coordinates are clamped to the edge of the layer.
+            int getTileIndex(int gx, int gy) {
                 if (gx < 0) gx  = 0;
                 if (gy < 0) gy = 0;
                 if (gx >= width) gx = width - 1;
                 if (gy >= height) gy = height - 1;
-                int index = (gy * width) + gx;
-                return tiles[index];
+                return (gy * width) + gx;
             }
 
-            Amara::Tile& setTileAt(int gx, int gy, int nid) {
-                Amara::Tile& tile = getTileAt(gx, gy);
-                tile.id = nid;
-                return tile;
+            int getTileIdAt(int gx, int gy) {
+                return unpackTileId(tiles[getTileIndex(gx, gy)]);
+            }
+
+            Amara::Tile getTile(int index) {
+                return Amara::Tile(tiles[index], index % width, index / width);
             }
 
-            Amara::Tile& getTileAtXY(float gx, float gy) {
+            Amara::Tile getTileAt(int gx, int gy) {
+                return getTile(getTileIndex(gx, gy));
+            }
+
+            // Keeps the tile's flip flags.
+            Amara::Tile setTileAt(int gx, int gy, int nid) {
+                int index = getTileIndex(gx, gy);
+                changeTileId(index, nid);
+                return getTile(index);
+            }
+
+            Amara::Tile getTileAtXY(float gx, float gy) {
                 float px = 0;
                 float py = 0;
                 if (tilemapEntity) {
@@ -280,226 +335,213 @@ namespace Amara {
                 return getTileAt(fx, fy);
             }
 
-            Amara::Tile& setTile(int index, int nid) {
-                Amara::Tile& tile = tiles[index];
-                tile.id = nid;
-                return tile;
+            Amara::Tile setTile(int index, int nid) {
+                changeTileId(index, nid);
+                return getTile(index);
             }
 
             void clear() {
-                for (Amara::Tile& tile: tiles) {
-                    tile.id = -1;
-                }
+                std::fill(tiles.begin(), tiles.end(), 0);
+                refreshTiles();
+                notifyTilemap(-1);
             }
 
-            void createDrawTexture() {
-                if (drawTexture) SDL_DestroyTexture(drawTexture);
-                drawTexture = SDL_CreateTexture(
-                    properties->gRenderer,
-                    SDL_PIXELFORMAT_RGBA8888,
-                    SDL_TEXTUREACCESS_TARGET,
-                    widthInPixels,
-                    heightInPixels
-                );
+            // Textures are made the first time a chunk is drawn.
+            void createChunks() {
+                destroyChunks();
+                chunksWide = (width + chunkSize - 1) / chunkSize;
+                chunksHigh = (height + chunkSize - 1) / chunkSize;
+                chunks.resize(chunksWide*chunksHigh);
             }
 
-            void run() {
-                std::unordered_map<int, Amara::TileAnimation>::iterator it = animations.begin();
-
-                while(it != animations.end()) {
-                    it->second.update();
-                    it++;
-                }
-                Amara::Actor::run();
+            void setChunkSize(int gSize) {
+                chunkSize = (gSize > 0) ? gSize : 1;
+                createChunks();
             }
 
-            void draw(int vx, int vy, int vw, int vh) {
-                if (!isVisible) return;
-                if (alpha < 0) alpha = 0;
-                if (alpha > 1) alpha = 1;
+            void setDrawMode(Amara::TilemapDrawMode gMode) {
+                drawMode = gMode;
+                if (drawMode == TILEMAP_DRAW_DIRECT) releaseChunkTextures();
+            }
 
-                int frame, maxFrame = 0;
-                float tileAngle = 0;
-                float tx, ty;
+            void refreshTile(int index) {
+                if (index < 0 || index >= tiles.size() || width <= 0) return;
+                int cx = (index % width) / chunkSize;
+                int cy = (index / width) / chunkSize;
+                if (cx < chunksWide && cy < chunksHigh) {
+                    chunks[cy*chunksWide + cx].dirty = true;
+                }
+            }
 
-                SDL_Texture* recTarget = SDL_GetRenderTarget(properties->gRenderer);
-                SDL_SetRenderTarget(properties->gRenderer, drawTexture);
-                SDL_RenderSetViewport(gRenderer, NULL);
-                SDL_SetTextureBlendMode(texture->asset, SDL_BLENDMODE_BLEND);
-				SDL_SetTextureAlphaMod(texture->asset, 255);
-                SDL_SetRenderDrawColor(properties->gRenderer, 0, 0, 0, 0);
-                SDL_RenderClear(properties->gRenderer);
+            // For tiles written in place, which may have become animated or stopped being so.
+            void refreshTileAt(int gx, int gy) {
+                if (gx < 0 || gy < 0 || gx >= width || gy >= height) return;
+                refreshTile(gy*width + gx);
+                animatedTilesStale = true;
+                notifyTilemap(gy*width + gx);
+            }
 
-                float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-                float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+            // Lets the tilemap update its walls, -1 for the whole layer. Defined after Tilemap.
+            void notifyTilemap(int index);
 
-                float px = 0;
-                float py = 0;
-                if (tilemapEntity) {
-                    px = tilemapEntity->x;
-                    py = tilemapEntity->y;
+            void refreshTiles() {
+                for (Amara::TilemapChunk& chunk: chunks) {
+                    chunk.dirty = true;
                 }
+                animatedTilesStale = true;
+            }
 
-                Amara::Camera* cam = properties->currentCamera;
-                Amara::Tile& startTile = getTileAtXY(properties->scrollX, properties->scrollY);
-                Amara::Tile& endTile = getTileAtXY(properties->scrollX+(vw/nzoomX), properties->scrollY+(vh/nzoomY));
-                int startX = startTile.x;
-                int startY = startTile.y;
-                int endX = endTile.x;
-                int endY = endTile.y;
+            bool isAnimatedId(int tileId) {
+                return tileId >= 0 && tileId < animatedIds.size() && animatedIds[tileId];
+            }
 
-                if (startX < 0) startX = 0;
-                if (startY < 0) startY = 0;
-                if (endX >= width) endX = width - 1;
-                if (endY >= height) endY = height - 1;
+            // The frame of the texture drawn for the tile id this tick, expects frameRects to be filled.
+            int getTileFrame(int tileId) {
+                if (tileId < tileFrames.size()) return tileFrames[tileId];
+                return tileId % frameRects.size();
+            }
 
-                origin.x = 0;
-                origin.y = 0;
-                destRect.w = tileWidth;
-                destRect.h = tileHeight;
-                
-                for (int i = startX; i <= endX; i++) {
-                    for (int j = startY; j <= endY ; j++) {
-                        Amara::Tile& tile = getTileAt(i, j);
-                        frame = tile.id;
+            void buildFrameTables() {
+                frameTablesStale = false;
+                framesTexture = texture;
+                frameRects.clear();
+                tileFrames.clear();
+                animatedIds.clear();
 
-                        if (frame == -1) {
-                            continue;
-                        }
+                int numIds = 0;
+                for (Amara::TileAnimation& anim: animations) {
+                    if (anim.id >= numIds) numIds = anim.id + 1;
+                }
+                animatedIds.resize(numIds, 0);
+                for (Amara::TileAnimation& anim: animations) {
+                    if (anim.id >= 0) animatedIds[anim.id] = 1;
+                }
+                refreshTiles();
+
+                if (texture == nullptr || tileWidth <= 0 || tileHeight <= 0) return;
+                int columns = texture->width / tileWidth;
+                int numFrames = columns * (texture->height / tileHeight);
+                if (numFrames <= 0) return;
+
+                frameRects.resize(numFrames);
+                for (int i = 0; i < numFrames; i++) {
+                    SDL_Rect& rect = frameRects[i];
+                    rect.x = (i % columns) * tileWidth + texture->offsetX;
+                    rect.y = (i / columns) * tileHeight + texture->offsetY;
+                    rect.w = tileWidth;
+                    rect.h = tileHeight;
+                }
 
-                        tileAngle = 0;
-                        flip = SDL_FLIP_NONE;
-                        if (tile.fhorizontal) {
-                            if (tile.fvertical) {
-                                if (tile.fdiagonal) {
-                                    tileAngle = 90;
-                                    flip = SDL_FLIP_VERTICAL;
-                                }
-                                else {
-                                    tileAngle = 180;
-                                }
-                            }
-                            else if (tile.fdiagonal) {
-                                tileAngle = 90;
-                            }
-                            else {
-                                flip = SDL_FLIP_HORIZONTAL;
-                            }
-                        }
-                        else if (tile.fvertical) {
-                            if (tile.fdiagonal) {
-                                tileAngle = -90;
-                            }
-                            else {
-                                flip = SDL_FLIP_VERTICAL;
-                            }
-                        }
-                        
-                        tx = tile.x * tileWidth;
-                        ty = tile.y * tileHeight;
+                tileFrames.resize(std::max(numFrames, numIds));
+                for (int i = 0; i < tileFrames.size(); i++) {
+                    tileFrames[i] = i % numFrames;
+                }
+                for (Amara::TileAnimation& anim: animations) {
+                    if (anim.id >= 0) tileFrames[anim.id] = anim.currentTileId % numFrames;
+                }
+            }
 
-                        bool skipDrawing = false;
-                        
-                        destRect.x = tx;
-                        destRect.y = ty;
+            void run() {
+                if (properties->renderDeviceReset) {
+                    createChunks();
+                }
+                else if (properties->renderTargetsReset) {
+                    refreshTiles();
+                }
+                if (frameTablesStale || framesTexture != texture) buildFrameTables();
+                if (animatedTilesStale) findAnimatedTiles();
+
+                bool changed = false;
+                changedIds.resize(animatedIds.size(), 0);
+                for (Amara::TileAnimation& anim: animations) {
+                    int recTileId = anim.currentTileId;
+                    anim.update();
+                    if (anim.currentTileId == recTileId || anim.id < 0) continue;
+                    changed = true;
+                    changedIds[anim.id] = 1;
+                    if (!frameRects.empty()) tileFrames[anim.id] = anim.currentTileId % frameRects.size();
+                }
 
-                        if (destRect.x + destRect.w <= 0) skipDrawing = true;
-                        if (destRect.y + destRect.h <= 0) skipDrawing = true;
-                        if (destRect.w <= 0) skipDrawing = true;
-                        if (destRect.h <= 0) skipDrawing = true;
+                if (changed) {
+                    if (drawMode == TILEMAP_DRAW_CHUNKS) {
+                        for (int index: animatedTiles) {
+                            if (changedIds[unpackTileId(tiles[index])]) refreshTile(index);
+                        }
+                    }
+                    std::fill(changedIds.begin(), changedIds.end(), 0);
+                }
+                Amara::Actor::run();
+            }
 
-                        if (!skipDrawing) {
-                            int hx = 0, hy = 0, hw = 0, hh = 0;
-                            hw = destRect.w;
-                            hh = destRect.h;
+            // Drawn at the tilemap's position, so it moves with it.
+            bool isInterpolating() {
+                if (tilemapEntity && tilemapEntity->isInterpolating()) return true;
+                return Amara::Actor::isInterpolating();
+            }
 
-                            if (destRect.x >= 0) {
-                                hx = destRect.x + vx;
-                            }
-                            else {
-                                hw -= -(destRect.x);
-                                hx = vx;
-                            }
-                            if (destRect.y >= 0) {
-                                hy = destRect.y + vy;
-                            }
-                            else {
-                                hh -= -(destRect.h);
-                                hy = vy;
-                            }
-                            if (hx + hw > vx + vw) hw = (vx - hx);
-                            if (hy + hh > vy + vh) hh = (vy - hy);
-
-                            checkForHover(hx, hy, hw, hh);
-                            
-                            auto got = animations.find(frame);
-                            if (got != animations.end()) {
-                                frame = got->second.currentTileId;
-                            }
+            bool getDrawBounds(Amara::FloatRect& bounds) {
+                if (!entities.empty()) return false;
+                if (scrollFactorX != 1 || scrollFactorY != 1 || zoomFactorX != 1 || zoomFactorY != 1) return false;
 
-                            if (texture != nullptr) {
-                                SDL_Texture* tex = (SDL_Texture*)texture->asset;
-                                maxFrame = ((texture->width / tileWidth) * (texture->height / tileHeight));
-                                frame = frame % maxFrame;
+                float px = 0;
+                float py = 0;
+                if (tilemapEntity) {
+                    px = tilemapEntity->getInterpolatedX();
+                    py = tilemapEntity->getInterpolatedY();
+                }
+                float absScaleX = fabs(scaleX);
+                float absScaleY = fabs(scaleY);
+                bounds.x = getInterpolatedX() + px - (originX * imageWidth * absScaleX);
+                bounds.y = getInterpolatedY() - getInterpolatedZ() + py - (originY * imageHeight * absScaleY);
+                bounds.width = widthInPixels * absScaleX;
+                bounds.height = heightInPixels * absScaleY;
+                padBoundsForAngle(bounds, bounds.x + imageWidth*absScaleX*originX, bounds.y + imageHeight*absScaleY*originY);
+                return true;
+            }
 
-                                srcRect.x = (frame % (texture->width / tileWidth)) * tileHeight;
-                                srcRect.y = floor(frame / (texture->width / tileWidth)) * tileHeight;
-                                srcRect.w = tileWidth;
-                                srcRect.h = tileHeight;
+            void draw(int vx, int vy, int vw, int vh) {
+                if (!isVisible) return;
+                if (alpha < 0) alpha = 0;
+                if (alpha > 1) alpha = 1;
 
-                                if (tile.x == 0 && tile.y == 0) {
-                                    
-                                }
+                Amara::Transform transform = getDrawTransform();
+                float nzoomX = transform.getZoomX(zoomFactorX);
+                float nzoomY = transform.getZoomY(zoomFactorY);
 
-                                SDL_RenderCopyExF(
-                                    gRenderer,
-                                    tex,
-                                    &srcRect,
-                                    &destRect,
-                                    angle + tileAngle,
-                                    &origin,
-                                    flip
-                                );
-                            }
-                        }
-                    }
+                float px = 0;
+                float py = 0;
+                if (tilemapEntity) {
+                    px = tilemapEntity->getInterpolatedX();
+                    py = tilemapEntity->getInterpolatedY();
                 }
 
-                SDL_SetRenderTarget(properties->gRenderer, recTarget);
-                viewport.x = vx;
-                viewport.y = vy;
-                viewport.w = vw;
-                viewport.h = vh;
-                SDL_RenderSetViewport(gRenderer, &viewport);
+                float drawX = getInterpolatedX();
+                float drawY = getInterpolatedY() - getInterpolatedZ();
 
-                destRect.x = ((x+px - properties->scrollX*scrollFactorX + properties->offsetX - (originX * imageWidth * scaleX)) * nzoomX);
-                destRect.y = ((y-z+py - properties->scrollY*scrollFactorY + properties->offsetY - (originY * imageHeight * scaleY)) * nzoomY);
-                destRect.w = (widthInPixels*scaleX*nzoomX);
-                destRect.h = (heightInPixels*scaleY*nzoomY);
+                // Where the layer's top left corner lands in the viewport, and how big a map pixel is there.
+                float left = ((transform.getScreenX(drawX+px, scrollFactorX) - (originX * imageWidth * scaleX)) * nzoomX);
+                float top = ((transform.getScreenY(drawY+py, scrollFactorY) - (originY * imageHeight * scaleY)) * nzoomY);
+                float pixelWidth = scaleX * nzoomX;
+                float pixelHeight = scaleY * nzoomY;
 
-                if (pixelLocked) {
-                    destRect.x = floor(destRect.x);
-                    destRect.y = floor(destRect.y);
-                    destRect.w = ceil(destRect.w);
-                    destRect.h = ceil(destRect.h);
-                }
+                if (frameTablesStale || framesTexture != texture) buildFrameTables();
 
-                origin.x = destRect.w * originX;
-                origin.y = destRect.h * originY;
+                if (!frameRects.empty() && pixelWidth > 0 && pixelHeight > 0) {
+                    checkLayerHover(left, top, widthInPixels*pixelWidth, heightInPixels*pixelHeight, vx, vy, vw, vh);
 
-                SDL_SetTextureBlendMode(drawTexture, blendMode);
-                SDL_SetTextureAlphaMod(drawTexture, properties->alpha * alpha * 255);
+                    viewport.x = vx;
+                    viewport.y = vy;
+                    viewport.w = vw;
+                    viewport.h = vh;
+                    Uint8 drawAlpha = transform.alpha * alpha * 255;
+                    if (drawMode == TILEMAP_DRAW_DIRECT || chunks.empty()) {
+                        drawDirect(left, top, pixelWidth, pixelHeight, vw, vh, drawAlpha);
+                    }
+                    else {
+                        drawChunks(left, top, pixelWidth, pixelHeight, vw, vh, drawAlpha);
+                    }
+                }
 
-                SDL_RenderCopyExF(
-                    properties->gRenderer,
-                    drawTexture,
-                    NULL,
-                    &destRect,
-                    0,
-                    &origin,
-                    SDL_FLIP_NONE
-                );
-                
                 Amara::Actor::draw(vx, vy, vw, vh);
             }
 
@@ -533,7 +575,300 @@ namespace Amara {
             }
 
             ~TilemapLayer() {
-                if (drawTexture) SDL_DestroyTexture(drawTexture);
+                destroyChunks();
+            }
+
+        private:
+            std::vector<Uint8> changedIds;
+
+            void changeTileId(int index, int nid) {
+                if (index < 0 || index >= tiles.size()) return;
+                int id = unpackTileId(tiles[index]);
+                if (nid < 0) nid = -1;
+                if (id == nid) return;
+                if (isAnimatedId(id) || isAnimatedId(nid)) animatedTilesStale = true;
+                if (nid < 0) tiles[index] = 0;
+                else tiles[index] = packTile(nid) | (tiles[index] & Amara::TILED_FLIPFLAGS);
+                refreshTile(index);
+                notifyTilemap(index);
+            }
+
+            void findAnimatedTiles() {
+                animatedTilesStale = false;
+                animatedTiles.clear();
+                if (animatedIds.empty()) return;
+                for (int i = 0; i < tiles.size(); i++) {
+                    if (isAnimatedId(unpackTileId(tiles[i]))) animatedTiles.push_back(i);
+                }
+            }
+
+            void destroyChunks() {
+                releaseChunkTextures();
+                chunks.clear();
+            }
+
+            void getTileOrientation(Uint32 gid, float& tileAngle, SDL_RendererFlip& tileFlip) {
+                tileAngle = 0;
+                tileFlip = SDL_FLIP_NONE;
+                if ((gid & Amara::TILED_FLIPFLAGS) == 0) return;
+
+                bool fhorizontal = (gid & Amara::TILED_FLIPPEDHORIZONTALLY) != 0;
+                bool fvertical = (gid & Amara::TILED_FLIPPEDVERTICALLY) != 0;
+                bool fdiagonal = (gid & Amara::TILED_FLIPPEDANTIDIAGONALLY) != 0;
+                if (fhorizontal) {
+                    if (fvertical) {
+                        if (fdiagonal) {
+                            tileAngle = 90;
+                            tileFlip = SDL_FLIP_VERTICAL;
+                        }
+                        else {
+                            tileAngle = 180;
+                        }
+                    }
+                    else if (fdiagonal) {
+                        tileAngle = 90;
+                    }
+                    else {
+                        tileFlip = SDL_FLIP_HORIZONTAL;
+                    }
+                }
+                else if (fvertical) {
+                    if (fdiagonal) {
+                        tileAngle = -90;
+                    }
+                    else {
+                        tileFlip = SDL_FLIP_VERTICAL;
+                    }
+                }
+            }
+
+            void releaseChunkTextures() {
+                for (Amara::TilemapChunk& chunk: chunks) {
+                    if (chunk.texture) SDL_DestroyTexture(chunk.texture);
+                    chunk.texture = nullptr;
+                    chunk.dirty = true;
+                }
+                numChunkTextures = 0;
+            }
+
+            /*
+             * Draws tiles startX to endX and startY to endY, exclusive, with the map's top left corner at left, top.
+             */
+            void drawTiles(int startX, int startY, int endX, int endY, float left, float top, float pixelWidth, float pixelHeight, SDL_BlendMode tileBlend, Uint8 tileAlpha) {
+                SDL_FPoint tileOrigin = { 0, 0 };
+                SDL_FRect tileDest;
+
+                float tileAngle;
+                SDL_RendererFlip tileFlip;
+                for (int j = startY; j < endY; j++) {
+                    float y1 = top + j * tileHeight * pixelHeight;
+                    float y2 = top + (j + 1) * tileHeight * pixelHeight;
+                    if (pixelLocked) {
+                        y1 = floor(y1);
+                        y2 = floor(y2);
+                    }
+                    for (int i = startX; i < endX; i++) {
+                        Uint32 gid = tiles[j*width + i];
+                        if (gid == 0) continue;
+
+                        float x1 = left + i * tileWidth * pixelWidth;
+                        float x2 = left + (i + 1) * tileWidth * pixelWidth;
+                        if (pixelLocked) {
+                            x1 = floor(x1);
+                            x2 = floor(x2);
+                        }
+
+                        tileDest.x = x1;
+                        tileDest.y = y1;
+                        tileDest.w = x2 - x1;
+                        tileDest.h = y2 - y1;
+
+                        getTileOrientation(gid, tileAngle, tileFlip);
+                        properties->spriteBatch->draw(
+                            texture->asset,
+                            tileBlend,
+                            frameRects[getTileFrame(unpackTileId(gid))],
+                            tileDest,
+                            angle + tileAngle,
+                            tileOrigin,
+                            tileFlip,
+                            tileAlpha
+                        );
+                    }
+                }
+            }
+
+            void drawDirect(float left, float top, float pixelWidth, float pixelHeight, int vw, int vh, Uint8 drawAlpha) {
+                int startX = floor(-left / (tileWidth * pixelWidth));
+                int startY = floor(-top / (tileHeight * pixelHeight));
+                int endX = floor((vw - left) / (tileWidth * pixelWidth)) + 1;
+                int endY = floor((vh - top) / (tileHeight * pixelHeight)) + 1;
+                if (startX < 0) startX = 0;
+                if (startY < 0) startY = 0;
+                if (endX > width) endX = width;
+                if (endY > height) endY = height;
+                if (startX >= endX || startY >= endY) return;
+
+                properties->spriteBatch->setViewport(viewport);
+                drawTiles(startX, startY, endX, endY, left, top, pixelWidth, pixelHeight, blendMode, drawAlpha);
+            }
+
+            void drawChunks(float left, float top, float pixelWidth, float pixelHeight, int vw, int vh, Uint8 drawAlpha) {
+                int chunkPixelWidth = chunkSize * tileWidth;
+                int chunkPixelHeight = chunkSize * tileHeight;
+                int startX = floor(-left / (chunkPixelWidth * pixelWidth));
+                int startY = floor(-top / (chunkPixelHeight * pixelHeight));
+                int endX = floor((vw - left) / (chunkPixelWidth * pixelWidth));
+                int endY = floor((vh - top) / (chunkPixelHeight * pixelHeight));
+                if (startX < 0) startX = 0;
+                if (startY < 0) startY = 0;
+                if (endX >= chunksWide) endX = chunksWide - 1;
+                if (endY >= chunksHigh) endY = chunksHigh - 1;
+                if (startX > endX || startY > endY) return;
+
+                if (angle != chunkAngle) {
+                    chunkAngle = angle;
+                    refreshTiles();
+                }
+                drawCount += 1;
+
+                // Chunks that changed are redrawn first, so the render target only switches away once.
+                SDL_Texture* recTarget = nullptr;
+                bool redrawing = false;
+                for (int cy = startY; cy <= endY; cy++) {
+                    for (int cx = startX; cx <= endX; cx++) {
+                        Amara::TilemapChunk& chunk = chunks[cy*chunksWide + cx];
+                        chunk.lastDrawn = drawCount;
+                        if (!chunk.dirty && chunk.texture != nullptr) continue;
+                        if (!redrawing) {
+                            Amara::SpriteBatch::flush(properties);
+                            recTarget = SDL_GetRenderTarget(gRenderer);
+                            redrawing = true;
+                        }
+                        drawChunk(cx, cy);
+                    }
+                }
+                if (redrawing) {
+                    Amara::SpriteBatch::flush(properties);
+                    SDL_SetRenderTarget(gRenderer, recTarget);
+                }
+                if (numChunkTextures > maxChunkTextures) evictChunks();
+
+                properties->spriteBatch->setViewport(viewport);
+
+                origin.x = 0;
+                origin.y = 0;
+                for (int cy = startY; cy <= endY; cy++) {
+                    for (int cx = startX; cx <= endX; cx++) {
+                        Amara::TilemapChunk& chunk = chunks[cy*chunksWide + cx];
+                        if (chunk.texture == nullptr) {
+                            // No texture to be had for it, draw its tiles as they are.
+                            drawTiles(
+                                cx * chunkSize, cy * chunkSize,
+                                std::min((cx + 1) * chunkSize, width), std::min((cy + 1) * chunkSize, height),
+                                left, top, pixelWidth, pixelHeight, blendMode, drawAlpha
+                            );
+                            continue;
+                        }
+
+                        int chunkX = cx * chunkPixelWidth;
+                        int chunkY = cy * chunkPixelHeight;
+                        srcRect.x = 0;
+                        srcRect.y = 0;
+                        srcRect.w = std::min(chunkPixelWidth, widthInPixels - chunkX);
+                        srcRect.h = std::min(chunkPixelHeight, heightInPixels - chunkY);
+
+                        // Both edges come from the layer's corner so neighbouring chunks meet without gaps.
+                        float x1 = left + chunkX * pixelWidth;
+                        float y1 = top + chunkY * pixelHeight;
+                        float x2 = left + (chunkX + srcRect.w) * pixelWidth;
+                        float y2 = top + (chunkY + srcRect.h) * pixelHeight;
+                        if (pixelLocked) {
+                            x1 = floor(x1);
+                            y1 = floor(y1);
+                            x2 = floor(x2);
+                            y2 = floor(y2);
+                        }
+                        destRect.x = x1;
+                        destRect.y = y1;
+                        destRect.w = x2 - x1;
+                        destRect.h = y2 - y1;
+
+                        properties->spriteBatch->draw(
+                            chunk.texture,
+                            blendMode,
+                            srcRect,
+                            destRect,
+                            0,
+                            origin,
+                            SDL_FLIP_NONE,
+                            drawAlpha
+                        );
+                    }
+                }
+            }
+
+            // Renders the chunk's tiles into its texture, expects the sprite batch to be flushed.
+            void drawChunk(int cx, int cy) {
+                Amara::TilemapChunk& chunk = chunks[cy*chunksWide + cx];
+                int startX = cx * chunkSize;
+                int startY = cy * chunkSize;
+                int endX = std::min(startX + chunkSize, width);
+                int endY = std::min(startY + chunkSize, height);
+
+                if (chunk.texture == nullptr) {
+                    chunk.texture = SDL_CreateTexture(
+                        gRenderer,
+                        SDL_PIXELFORMAT_RGBA8888,
+                        SDL_TEXTUREACCESS_TARGET,
+                        (endX - startX) * tileWidth,
+                        (endY - startY) * tileHeight
+                    );
+                    if (chunk.texture == nullptr) return;
+                    numChunkTextures += 1;
+                }
+                chunk.dirty = false;
+
+                SDL_SetRenderTarget(gRenderer, chunk.texture);
+                properties->spriteBatch->setFullViewport();
+                SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 0);
+                SDL_RenderClear(gRenderer);
+
+                drawTiles(startX, startY, endX, endY, -startX * tileWidth, -startY * tileHeight, 1, 1, SDL_BLENDMODE_BLEND, 255);
+                properties->spriteBatch->flush();
+            }
+
+            // Frees the textures of the chunks that have been off screen the longest.
+            void evictChunks() {
+                std::vector<Amara::TilemapChunk*> resident;
+                for (Amara::TilemapChunk& chunk: chunks) {
+                    if (chunk.texture && chunk.lastDrawn != drawCount) resident.push_back(&chunk);
+                }
+                int excess = numChunkTextures - maxChunkTextures;
+                if (excess > (int)resident.size()) excess = resident.size();
+                if (excess <= 0) return;
+
+                std::nth_element(resident.begin(), resident.begin() + (excess - 1), resident.end(),
+                    [](Amara::TilemapChunk* a, Amara::TilemapChunk* b) {
+                        return a->lastDrawn < b->lastDrawn;
+                    }
+                );
+                for (int i = 0; i < excess; i++) {
+                    SDL_DestroyTexture(resident[i]->texture);
+                    resident[i]->texture = nullptr;
+                    resident[i]->dirty = true;
+                    numChunkTextures -= 1;
+                }
+            }
+
+            // One hover check for the part of the layer inside the viewport.
+            void checkLayerHover(float lx, float ly, float lw, float lh, int vx, int vy, int vw, int vh) {
+                float x1 = std::max(lx, 0.0f);
+                float y1 = std::max(ly, 0.0f);
+                float x2 = std::min(lx + lw, (float)vw);
+                float y2 = std::min(ly + lh, (float)vh);
+                if (x2 <= x1 || y2 <= y1) return;
+                checkForHover(vx + x1, vy + y1, x2 - x1, y2 - y1);
             }
     };
 }
@@ -27,10 +27,14 @@ namespace Amara {
         }
 
         void virtualizeXY(SDL_Event& e) {
+            virtualizeXY(e.tfinger.x, e.tfinger.y);
+        }
+
+        void virtualizeXY(float fx, float fy) {
             float upScale, offset;
 
-            x = e.tfinger.x * (float)properties->resolution->width;
-            y = e.tfinger.y * (float)properties->resolution->height;
+            x = fx * (float)properties->resolution->width;
+            y = fy * (float)properties->resolution->height;
             dx = x;
             dy = y;
 
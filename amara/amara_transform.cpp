@@ -0,0 +1,170 @@
+#pragma once
+#ifndef AMARA_TRANSFORM
+#define AMARA_TRANSFORM
+
+#include "amara.h"
+
+namespace Amara {
+    /*
+     * An entity's transform relative to whatever it's drawn under, a camera or a container.
+     * Doesn't depend on the camera, so it's kept between frames and cameras.
+     */
+    struct WorldTransform {
+        float offsetX = 0;
+        float offsetY = 0;
+        float zoomX = 1;
+        float zoomY = 1;
+        float scrollFactorX = 1;
+        float scrollFactorY = 1;
+        float zoomFactorX = 1;
+        float zoomFactorY = 1;
+        float angle = 0;
+        float alpha = 1;
+
+        // This transform followed by a child's local one.
+        Amara::WorldTransform then(const Amara::WorldTransform& local) const {
+            Amara::WorldTransform world;
+            world.offsetX = offsetX + local.offsetX;
+            world.offsetY = offsetY + local.offsetY;
+            world.zoomX = zoomX * local.zoomX;
+            world.zoomY = zoomY * local.zoomY;
+            world.scrollFactorX = scrollFactorX * local.scrollFactorX;
+            world.scrollFactorY = scrollFactorY * local.scrollFactorY;
+            world.zoomFactorX = zoomFactorX * local.zoomFactorX;
+            world.zoomFactorY = zoomFactorY * local.zoomFactorY;
+            world.angle = angle + local.angle;
+            world.alpha = alpha * local.alpha;
+            return world;
+        }
+
+        bool operator==(const Amara::WorldTransform& other) const {
+            return offsetX == other.offsetX && offsetY == other.offsetY && zoomX == other.zoomX && zoomY == other.zoomY
+                && scrollFactorX == other.scrollFactorX && scrollFactorY == other.scrollFactorY
+                && zoomFactorX == other.zoomFactorX && zoomFactorY == other.zoomFactorY
+                && angle == other.angle && alpha == other.alpha;
+        }
+        bool operator!=(const Amara::WorldTransform& other) const {
+            return !(*this == other);
+        }
+    };
+
+    /*
+     * What an entity is drawn with, the view it's drawn under applied to its parent's world transform.
+     * The view is a camera's scroll and zoom, or what a container draws its children with.
+     */
+    struct Transform {
+        float scrollX = 0;
+        float scrollY = 0;
+        float offsetX = 0;
+        float offsetY = 0;
+        float zoomX = 1;
+        float zoomY = 1;
+        float zoomFactorX = 1;
+        float zoomFactorY = 1;
+        float angle = 0;
+        float alpha = 1;
+
+        // Zoom applied to something with its own zoom factors.
+        float getZoomX(float factorX) const {
+            return 1 + (zoomX - 1) * factorX * zoomFactorX;
+        }
+        float getZoomY(float factorY) const {
+            return 1 + (zoomY - 1) * factorY * zoomFactorY;
+        }
+
+        // Position relative to the viewport before zoom is applied.
+        float getScreenX(float gx, float factorX) const {
+            return gx - scrollX * factorX + offsetX;
+        }
+        float getScreenY(float gy, float factorY) const {
+            return gy - scrollY * factorY + offsetY;
+        }
+
+        Amara::Transform apply(const Amara::WorldTransform& world) const {
+            Amara::Transform transform;
+            transform.scrollX = scrollX * world.scrollFactorX;
+            transform.scrollY = scrollY * world.scrollFactorY;
+            transform.offsetX = offsetX + world.offsetX;
+            transform.offsetY = offsetY + world.offsetY;
+            transform.zoomX = zoomX * world.zoomX;
+            transform.zoomY = zoomY * world.zoomY;
+            transform.zoomFactorX = zoomFactorX * world.zoomFactorX;
+            transform.zoomFactorY = zoomFactorY * world.zoomFactorY;
+            transform.angle = angle + world.angle;
+            transform.alpha = alpha * world.alpha;
+            return transform;
+        }
+
+        void reset() {
+            *this = Amara::Transform();
+        }
+    };
+
+    /*
+     * Every entity's world transform in one set of arrays, indexed by Entity::transformSlot.
+     * A slot is only recomputed when its entity's own fields or its parent's slot changed,
+     * version counts those changes so children can tell their parent's slot is still the same.
+     */
+    class TransformStore {
+        public:
+            std::vector<Amara::WorldTransform> world;
+            // The entity's own part, kept to tell whether it changed.
+            std::vector<Amara::WorldTransform> local;
+            std::vector<Uint32> version;
+            // The parent slot and version the world transform was worked out from.
+            std::vector<int> parentSlot;
+            std::vector<Uint32> parentVersion;
+
+            int acquire() {
+                int slot;
+                if (!freeSlots.empty()) {
+                    slot = freeSlots.back();
+                    freeSlots.pop_back();
+                }
+                else {
+                    slot = world.size();
+                    world.emplace_back();
+                    local.emplace_back();
+                    version.push_back(0);
+                    parentSlot.push_back(-1);
+                    parentVersion.push_back(0);
+                }
+                // Versions keep counting through reuse, a child never mistakes a new owner for its old parent.
+                world[slot] = Amara::WorldTransform();
+                local[slot] = Amara::WorldTransform();
+                version[slot] += 1;
+                parentSlot[slot] = -1;
+                parentVersion[slot] = 0;
+                return slot;
+            }
+
+            void release(int slot) {
+                if (slot < 0) return;
+                version[slot] += 1;
+                freeSlots.push_back(slot);
+            }
+
+            // Recomputes the slot if it's out of date, returns false if it was clean.
+            bool update(int slot, int gParentSlot, const Amara::WorldTransform& gLocal) {
+                Uint32 gParentVersion = (gParentSlot < 0) ? 0 : version[gParentSlot];
+                if (parentSlot[slot] == gParentSlot && parentVersion[slot] == gParentVersion && local[slot] == gLocal) {
+                    return false;
+                }
+                local[slot] = gLocal;
+                parentSlot[slot] = gParentSlot;
+                parentVersion[slot] = gParentVersion;
+                world[slot] = (gParentSlot < 0) ? gLocal : world[gParentSlot].then(gLocal);
+                version[slot] += 1;
+                return true;
+            }
+
+            int size() {
+                return world.size() - freeSlots.size();
+            }
+
+        private:
+            std::vector<int> freeSlots;
+    };
+}
+
+#endif
@@ -112,6 +112,7 @@ namespace Amara {
                 viewport.y = vy;
                 viewport.w = vw;
                 viewport.h = vh;
+                Amara::SpriteBatch::flush(properties);
                 SDL_RenderSetViewport(properties->gRenderer, &viewport);
 
                 drawnRect.x = -1;
@@ -217,11 +217,11 @@ namespace Amara {
                 Amara::Actor::run();
             }
 
-            void drawText(float dx, float dy) {
+            void drawText(float dx, float dy, const Amara::Transform& transform) {
                 effect.alignment = (FC_AlignEnum)alignment;
 
-                float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-                float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+                float nzoomX = transform.getZoomX(zoomFactorX);
+                float nzoomY = transform.getZoomY(zoomFactorY);
 
                 effect.scale.x = scaleX * nzoomX;
                 effect.scale.y = scaleY * nzoomY;
@@ -240,8 +240,8 @@ namespace Amara {
                         FC_DrawColumnEffect(
                             fontAsset->font,
                             gRenderer,
-                            floor((dx - properties->scrollX + properties->offsetX - (width * originX) + offsetX) * nzoomX),
-                            floor((dy-z - properties->scrollY + properties->offsetY - (height * originY)) * nzoomY),
+                            floor((dx - transform.scrollX + transform.offsetX - (width * originX) + offsetX) * nzoomX),
+                            floor((dy-z - transform.scrollY + transform.offsetY - (height * originY)) * nzoomY),
                             wordWrapWidth,
                             effect,
                             txt
@@ -259,8 +259,8 @@ namespace Amara {
                         FC_DrawEffect(
                             fontAsset->font,
                             gRenderer,
-                            floor((dx - properties->scrollX + properties->offsetX - (width * originX) + offsetX) * nzoomX),
-                            floor((dy-z - properties->scrollY + properties->offsetY - (height * originY)) * nzoomY),
+                            floor((dx - transform.scrollX + transform.offsetX - (width * originX) + offsetX) * nzoomX),
+                            floor((dy-z - transform.scrollY + transform.offsetY - (height * originY)) * nzoomY),
                             effect,
                             txt
                         );
@@ -268,32 +268,49 @@ namespace Amara {
                 }
             }
 
+            void drawText(float dx, float dy) {
+                drawText(dx, dy, getDrawTransform());
+            }
+
+            bool getDrawBounds(Amara::FloatRect& bounds) {
+                if (!entities.empty()) return false;
+                if (scrollFactorX != 1 || scrollFactorY != 1 || zoomFactorX != 1 || zoomFactorY != 1) return false;
+
+                bounds.x = x - (width * originX) - outline;
+                bounds.y = y - z - (height * originY) - outline;
+                bounds.width = width + outline*2;
+                bounds.height = height + outline*2;
+                return true;
+            }
+
             void draw(int vx, int vy, int vw, int vh) {
                 viewport.x = vx;
                 viewport.y = vy;
                 viewport.w = vw;
                 viewport.h = vh;
+                Amara::SpriteBatch::flush(properties);
                 SDL_RenderSetViewport(gRenderer, &viewport);
 
-                color.a = alpha * properties->alpha * 255;
+                Amara::Transform transform = getDrawTransform();
+                color.a = alpha * transform.alpha * 255;
 
                 if (outline) {
                     effect.color = outlineColor;
                     for (int i = 0; i < outline+1; i++) {
-                        drawText(x+i,y);
-                        drawText(x-i,y);
+                        drawText(x+i,y, transform);
+                        drawText(x-i,y, transform);
                         for (int j = 0; j < outline+1; j++) {
                             if (outlineCorners || i != j || i != outline) {
-                                drawText(x+i,y+j);
-                                drawText(x-i,y-j);
-                                drawText(x+i,y-j);
-                                drawText(x-i,y+j);
+                                drawText(x+i,y+j, transform);
+                                drawText(x-i,y-j, transform);
+                                drawText(x+i,y-j, transform);
+                                drawText(x-i,y+j, transform);
                             }
                         }
                     }
                 }
                 effect.color = color;
-                drawText(x, y);
+                drawText(x, y, transform);
 
                 Amara::Entity::draw(vx, vy, vw, vh);
             }
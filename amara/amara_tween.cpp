@@ -20,6 +20,78 @@ namespace Amara {
             }
     };
 
+    /*
+     * Tween over up to maxFields float fields of the parent. Subclasses pick them in prepareFields(),
+     * the scene's TweenSystem then eases them and the script only waits for it to be done.
+     * Actors outside a scene ease their own fields.
+     */
+    class FieldTween: public Tween {
+        public:
+            static const int maxFields = 4;
+
+            float* fields[maxFields];
+            float starts[maxFields];
+            float targets[maxFields];
+            Amara::TweenHandle handles[maxFields];
+            int numFields = 0;
+            bool batched = false;
+
+            virtual void prepareFields(Amara::Actor* actor) {}
+
+            void tweenField(float* field, float target) {
+                if (numFields >= maxFields) return;
+                fields[numFields] = field;
+                starts[numFields] = *field;
+                targets[numFields] = target;
+                numFields += 1;
+            }
+
+            void prepare(Amara::Actor* actor) {
+                releaseFields();
+                numFields = 0;
+                prepareFields(actor);
+
+                batched = (actor->tweens != nullptr);
+                if (!batched) return;
+                for (int i = 0; i < numFields; i++) {
+                    handles[i] = actor->tweens->add(actor, fields[i], targets[i], time, easing);
+                }
+            }
+
+            void script() {
+                if (!batched) {
+                    progressFurther();
+                    for (int i = 0; i < numFields; i++) {
+                        *fields[i] = ease(easing, starts[i], targets[i], progress);
+                    }
+                    return;
+                }
+                if (numFields == 0 || !parent->tweens->isActive(handles[0])) {
+                    progress = 1;
+                    finish();
+                }
+                else progress = parent->tweens->getProgress(handles[0]);
+            }
+
+            // Finishing early leaves the fields where they are, like the unbatched tweens.
+            void finish() {
+                Amara::Tween::finish();
+                releaseFields();
+            }
+
+            void releaseFields() {
+                if (!batched || parent == nullptr || parent->tweens == nullptr) return;
+                for (int i = 0; i < numFields; i++) {
+                    parent->tweens->cancel(handles[i]);
+                    handles[i] = Amara::TweenHandle();
+                }
+            }
+
+            virtual ~FieldTween() {
+                releaseFields();
+            }
+    };
+
     class Tween_Wait: public Tween {
     public:
         Tween_Wait(double gt) {
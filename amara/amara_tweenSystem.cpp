@@ -0,0 +1,308 @@
+#pragma once
+#ifndef AMARA_TWEENSYSTEM
+#define AMARA_TWEENSYSTEM
+
+#include "amara.h"
+
+namespace Amara {
+    class Entity;
+
+    // Generation 0 is never handed out, so a default handle is never active.
+    struct TweenHandle {
+        Uint32 slot = 0;
+        Uint32 generation = 0;
+    };
+
+    // Every running tween with the same easing, one array per field.
+    struct TweenLane {
+        std::vector<float> start;
+        std::vector<float> delta;
+        std::vector<double> rate;
+        std::vector<double> progress;
+        std::vector<double> eased;
+        std::vector<float*> fields;
+        std::vector<Uint32> slots;
+
+        size_t size() {
+            return slots.size();
+        }
+
+        void push(float gStart, float gDelta, double gRate, float* field, Uint32 slot) {
+            start.push_back(gStart);
+            delta.push_back(gDelta);
+            rate.push_back(gRate);
+            progress.push_back(0);
+            eased.push_back(0);
+            fields.push_back(field);
+            slots.push_back(slot);
+        }
+
+        // Moves the last tween into index, returns the slot of the tween that moved.
+        Uint32 swapRemove(size_t index) {
+            size_t last = slots.size() - 1;
+            start[index] = start[last];
+            delta[index] = delta[last];
+            rate[index] = rate[last];
+            progress[index] = progress[last];
+            eased[index] = eased[last];
+            fields[index] = fields[last];
+            slots[index] = slots[last];
+
+            start.pop_back();
+            delta.pop_back();
+            rate.pop_back();
+            progress.pop_back();
+            eased.pop_back();
+            fields.pop_back();
+            slots.pop_back();
+            return (index < last) ? slots[index] : 0;
+        }
+
+        void clear() {
+            start.clear();
+            delta.clear();
+            rate.clear();
+            progress.clear();
+            eased.clear();
+            fields.clear();
+            slots.clear();
+        }
+    };
+
+    // Bookkeeping kept off the hot arrays, found through a handle's slot.
+    struct TweenRecord {
+        Uint32 generation = 0;
+        bool active = false;
+        bool paused = false;
+        Uint8 lane = 0;
+        size_t index = 0;
+        double rate = 0;
+        float target = 0;
+        Amara::Entity* owner = nullptr;
+        std::function<void()> onComplete;
+    };
+
+    /*
+     * Runs float tweens in bulk, each scene owns one and updates it once a tick.
+     * Tweens are grouped into a lane per easing and stored as arrays, so a tick is a few
+     * tight loops over every tween instead of a virtual script call and a switch per tween.
+     *
+     * Fields must outlive their tween. Tweens with an owner entity are cancelled when it's destroyed.
+     */
+    class TweenSystem {
+        public:
+            Amara::GameProperties* properties = nullptr;
+
+            // Reads sine, expo and elastic curves from EasingTables instead of evaluating them.
+            bool useTables = false;
+
+            Amara::TweenLane lanes[EASING_COUNT];
+            std::vector<Amara::TweenRecord> records;
+            std::unordered_map<Amara::Entity*, int> owners;
+            // Owners between pause() and resume(), tweens added for them start out paused.
+            std::unordered_set<Amara::Entity*> pausedOwners;
+
+            TweenSystem(Amara::GameProperties* gProperties) {
+                properties = gProperties;
+            }
+
+            Amara::TweenHandle add(Amara::Entity* owner, float* field, float target, double time, Amara::Easing easing) {
+                Uint32 slot = takeSlot();
+                Amara::TweenRecord& record = records[slot];
+                record.generation = ++generation;
+                record.active = true;
+                record.paused = (owner != nullptr && pausedOwners.find(owner) != pausedOwners.end());
+                record.lane = ((int)easing >= 0 && easing < EASING_COUNT) ? easing : LINEAR;
+                record.rate = 1/(time*properties->lps);
+                record.target = target;
+                record.owner = owner;
+                record.onComplete = nullptr;
+
+                Amara::TweenLane& lane = lanes[record.lane];
+                record.index = lane.size();
+                lane.push(*field, target - *field, record.paused ? 0 : record.rate, field, slot);
+                if (owner) owners[owner] += 1;
+
+                Amara::TweenHandle handle;
+                handle.slot = slot;
+                handle.generation = record.generation;
+                return handle;
+            }
+
+            Amara::TweenHandle add(float* field, float target, double time, Amara::Easing easing) {
+                return add(nullptr, field, target, time, easing);
+            }
+
+            // Called after the tween reaches its target, not when it's cancelled.
+            void onComplete(Amara::TweenHandle handle, std::function<void()> callback) {
+                Amara::TweenRecord* record = find(handle);
+                if (record) record->onComplete = callback;
+            }
+
+            bool isActive(Amara::TweenHandle handle) {
+                return find(handle) != nullptr;
+            }
+
+            // Progress before easing, 1 once the tween is done.
+            double getProgress(Amara::TweenHandle handle) {
+                Amara::TweenRecord* record = find(handle);
+                if (record == nullptr) return 1;
+                return lanes[record->lane].progress[record->index];
+            }
+
+            void update() {
+                for (int l = 0; l < EASING_COUNT; l++) {
+                    Amara::TweenLane& lane = lanes[l];
+                    size_t count = lane.size();
+                    if (count == 0) continue;
+
+                    double* progress = lane.progress.data();
+                    double* eased = lane.eased.data();
+                    const double* rate = lane.rate.data();
+                    for (size_t i = 0; i < count; i++) {
+                        double p = progress[i] + rate[i];
+                        progress[i] = (p < 1) ? p : 1;
+                    }
+
+                    easeAll((Amara::Easing)l, progress, eased, count, useTables);
+
+                    const float* start = lane.start.data();
+                    const float* delta = lane.delta.data();
+                    float** fields = lane.fields.data();
+                    for (size_t i = 0; i < count; i++) {
+                        *fields[i] = start[i] + delta[i]*eased[i];
+                    }
+
+                    for (size_t i = 0; i < count; i++) {
+                        if (progress[i] >= 1) completed.push_back(lane.slots[i]);
+                    }
+                }
+                if (completed.empty()) return;
+
+                // Callbacks can add and cancel tweens, so they run once the lanes are settled.
+                for (Uint32 slot: completed) {
+                    if (records[slot].active) finishCallbacks.push_back(release(slot));
+                }
+                completed.clear();
+                for (std::function<void()>& callback: finishCallbacks) {
+                    if (callback) callback();
+                }
+                finishCallbacks.clear();
+            }
+
+            // Stops the tween where it is.
+            void cancel(Amara::TweenHandle handle) {
+                if (find(handle)) release(handle.slot);
+            }
+
+            // Jumps the tween to its target and completes it.
+            void finish(Amara::TweenHandle handle) {
+                Amara::TweenRecord* record = find(handle);
+                if (record == nullptr) return;
+                *lanes[record->lane].fields[record->index] = record->target;
+                std::function<void()> callback = release(handle.slot);
+                if (callback) callback();
+            }
+
+            void cancel(Amara::Entity* owner) {
+                pausedOwners.erase(owner);
+                if (owners.find(owner) == owners.end()) return;
+                forOwned(owner, [this](Uint32 slot) {
+                    release(slot);
+                });
+            }
+
+            // Paused tweens hold their value until resumed.
+            void pause(Amara::Entity* owner) {
+                pausedOwners.insert(owner);
+                if (owners.find(owner) == owners.end()) return;
+                forOwned(owner, [this](Uint32 slot) {
+                    Amara::TweenRecord& record = records[slot];
+                    record.paused = true;
+                    lanes[record.lane].rate[record.index] = 0;
+                });
+            }
+
+            void resume(Amara::Entity* owner) {
+                pausedOwners.erase(owner);
+                if (owners.find(owner) == owners.end()) return;
+                forOwned(owner, [this](Uint32 slot) {
+                    Amara::TweenRecord& record = records[slot];
+                    record.paused = false;
+                    lanes[record.lane].rate[record.index] = record.rate;
+                });
+            }
+
+            size_t size() {
+                size_t total = 0;
+                for (int l = 0; l < EASING_COUNT; l++) total += lanes[l].size();
+                return total;
+            }
+
+            void clear() {
+                for (int l = 0; l < EASING_COUNT; l++) lanes[l].clear();
+                records.clear();
+                freeSlots.clear();
+                owners.clear();
+                pausedOwners.clear();
+                completed.clear();
+            }
+
+        private:
+            Uint32 generation = 0;
+            std::vector<Uint32> freeSlots;
+            std::vector<Uint32> completed;
+            std::vector<std::function<void()>> finishCallbacks;
+
+            Amara::TweenRecord* find(Amara::TweenHandle handle) {
+                if (handle.generation == 0 || handle.slot >= records.size()) return nullptr;
+                Amara::TweenRecord& record = records[handle.slot];
+                if (!record.active || record.generation != handle.generation) return nullptr;
+                return &record;
+            }
+
+            Uint32 takeSlot() {
+                if (!freeSlots.empty()) {
+                    Uint32 slot = freeSlots.back();
+                    freeSlots.pop_back();
+                    return slot;
+                }
+                records.emplace_back();
+                return records.size() - 1;
+            }
+
+            // Takes the tween out of its lane and hands back its completion callback.
+            std::function<void()> release(Uint32 slot) {
+                Amara::TweenRecord& record = records[slot];
+                Amara::TweenLane& lane = lanes[record.lane];
+                size_t index = record.index;
+                Uint32 moved = lane.swapRemove(index);
+                if (index < lane.size()) records[moved].index = index;
+
+                if (record.owner) {
+                    auto got = owners.find(record.owner);
+                    if (got != owners.end() && --got->second <= 0) owners.erase(got);
+                }
+
+                std::function<void()> callback;
+                callback.swap(record.onComplete);
+                record.active = false;
+                record.owner = nullptr;
+                freeSlots.push_back(slot);
+                return callback;
+            }
+
+            template <class Func>
+            void forOwned(Amara::Entity* owner, Func func) {
+                std::vector<Uint32> found;
+                for (int l = 0; l < EASING_COUNT; l++) {
+                    for (Uint32 slot: lanes[l].slots) {
+                        if (records[slot].owner == owner) found.push_back(slot);
+                    }
+                }
+                for (Uint32 slot: found) func(slot);
+            }
+    };
+}
+
+#endif
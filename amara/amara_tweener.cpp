@@ -39,17 +39,16 @@ namespace Amara {
 
             virtual void run() {
                 if (properties == nullptr) SDL_Log("PROBLEM");
-                Amara::Tween* tween;
-                for (auto it = tweens.begin(); it != tweens.end(); it++) {
-                    tween = *it;
-                    tween->run();
-                    if (tween->finished) {
-                        tweens.erase(it--);
-                        if (tween->deleteOnFinish) {
-                            delete tween;
-                        }
-                    }
+                for (size_t i = 0; i < tweens.size(); i++) {
+                    tweens[i]->run();
                 }
+                Amara::compact(tweens, [](Amara::Tween* tween) {
+                    if (!tween->finished) return false;
+                    if (tween->deleteOnFinish) {
+                        delete tween;
+                    }
+                    return true;
+                });
             }
     };
 }
@@ -42,26 +42,8 @@ namespace Amara {
 
             void script() {
                 Amara::Tween::progressFurther();
-                float nx = 0, ny = 0;
-
-                switch (easing) {
-                    case LINEAR:
-                        nx = linearEase(startX, targetX, progress);
-                        ny = linearEase(startY, targetY, progress);
-                        break;
-                    case SINE_INOUT:
-                        nx = sineInOutEase(startX, targetX, progress);
-                        ny = sineInOutEase(startY, targetY, progress);
-                        break;
-                    case SINE_IN:
-                        nx = sineInEase(startX, targetX, progress);
-                        ny = sineInEase(startY, targetY, progress);
-                        break;
-                    case SINE_OUT:
-                        nx = sineOutEase(startX, targetX, progress);
-                        ny = sineOutEase(startY, targetY, progress);
-                        break;
-                }
+                float nx = ease(easing, startX, targetX, progress);
+                float ny = ease(easing, startY, targetY, progress);
 
                 if (center) {
                     cam->centerOn(nx, ny);
@@ -104,25 +86,8 @@ namespace Amara {
 
             void script() {
                 Amara::Tween::progressFurther();
-                float nzx = 0, nzy = 0;
-                switch (easing) {
-                    case LINEAR:
-                        nzx = linearEase(zStartX, zTarget, progress);
-                        nzy = linearEase(zStartY, zTarget, progress);
-                        break;
-                    case SINE_INOUT:
-                        nzx = sineInOutEase(zStartX, zTarget, progress);
-                        nzy = sineInOutEase(zStartY, zTarget, progress);
-                        break;
-                    case SINE_IN:
-                        nzx = sineInEase(zStartX, zTarget, progress);
-                        nzy = sineInEase(zStartY, zTarget, progress);
-                        break;
-                    case SINE_OUT:
-                        nzx = sineOutEase(zStartX, zTarget, progress);
-                        nzy = sineOutEase(zStartY, zTarget, progress);
-                        break;
-                }
+                float nzx = ease(easing, zStartX, zTarget, progress);
+                float nzy = ease(easing, zStartY, zTarget, progress);
                 cam->setZoom(nzx, nzy);
             }
     };
@@ -5,7 +5,7 @@
 #include "amara.h"
 
 namespace Amara {
-    class Tween_XY: public Tween {
+    class Tween_XY: public FieldTween {
         public:
             float startX = 0;
             float startY = 0;
@@ -20,35 +20,15 @@ namespace Amara {
             }
             Tween_XY(float tx, float ty, double tt): Tween_XY(tx, ty, tt, LINEAR) {}
 
-            void prepare(Amara::Actor* actor) {
+            void prepareFields(Amara::Actor* actor) {
                 startX = actor->x;
                 startY = actor->y;
-            }
-
-            void script(Amara::Actor* actor) {
-                Amara::Tween::progressFurther();
-                switch (easing) {
-                    case LINEAR:
-                        actor->x = linearEase(startX, targetX, progress);
-                        actor->y = linearEase(startY, targetY, progress);
-                        break;
-                    case SINE_INOUT:
-                        actor->x = sineInOutEase(startX, targetX, progress);
-                        actor->y = sineInOutEase(startY, targetY, progress);
-                        break;
-                    case SINE_IN:
-                        actor->x = sineInEase(startX, targetX, progress);
-                        actor->y = sineInEase(startY, targetY, progress);
-                        break;
-                    case SINE_OUT:
-                        actor->x = sineOutEase(startX, targetX, progress);
-                        actor->y = sineOutEase(startY, targetY, progress);
-                        break;
-                }
+                tweenField(&actor->x, targetX);
+                tweenField(&actor->y, targetY);
             }
     };
 
-    class Tween_RelativeXY: public Tween {
+    class Tween_RelativeXY: public FieldTween {
         public:
             float startX = 0;
             float startY = 0;
@@ -63,37 +43,17 @@ namespace Amara {
             }
             Tween_RelativeXY(float tx, float ty, double tt): Tween_RelativeXY(tx, ty, tt, LINEAR) {}
 
-            void prepare(Amara::Actor* actor) {
+            void prepareFields(Amara::Actor* actor) {
                 startX = actor->x;
                 startY = actor->y;
                 targetX += actor->x;
                 targetY += actor->y;
-            }
-
-            void script(Amara::Actor* actor) {
-                Amara::Tween::progressFurther();
-                switch (easing) {
-                    case LINEAR:
-                        actor->x = linearEase(startX, targetX, progress);
-                        actor->y = linearEase(startY, targetY, progress);
-                        break;
-                    case SINE_INOUT:
-                        actor->x = sineInOutEase(startX, targetX, progress);
-                        actor->y = sineInOutEase(startY, targetY, progress);
-                        break;
-                    case SINE_IN:
-                        actor->x = sineInEase(startX, targetX, progress);
-                        actor->y = sineInEase(startY, targetY, progress);
-                        break;
-                    case SINE_OUT:
-                        actor->x = sineOutEase(startX, targetX, progress);
-                        actor->y = sineOutEase(startY, targetY, progress);
-                        break;
-                }
+                tweenField(&actor->x, targetX);
+                tweenField(&actor->y, targetY);
             }
     };
 
-	class Tween_XYZ: public Tween {
+	class Tween_XYZ: public FieldTween {
         public:
             float startX = 0;
             float startY = 0;
@@ -111,40 +71,17 @@ namespace Amara {
             }
             Tween_XYZ(float tx, float ty, float tz, double tt): Tween_XYZ(tx, ty, tz, tt, LINEAR) {}
 
-            void prepare(Amara::Actor* actor) {
+            void prepareFields(Amara::Actor* actor) {
                 startX = actor->x;
                 startY = actor->y;
 				startZ = actor->z;
-            }
-
-            void script(Amara::Actor* actor) {
-                Amara::Tween::progressFurther();
-                switch (easing) {
-                    case LINEAR:
-                        actor->x = linearEase(startX, targetX, progress);
-                        actor->y = linearEase(startY, targetY, progress);
-						actor->z = linearEase(startZ, targetZ, progress);
-                        break;
-                    case SINE_INOUT:
-                        actor->x = sineInOutEase(startX, targetX, progress);
-                        actor->y = sineInOutEase(startY, targetY, progress);
-						actor->z = sineInOutEase(startZ, targetZ, progress);
-                        break;
-                    case SINE_IN:
-                        actor->x = sineInEase(startX, targetX, progress);
-                        actor->y = sineInEase(startY, targetY, progress);
-						actor->z = sineInEase(startZ, targetZ, progress);
-                        break;
-                    case SINE_OUT:
-                        actor->x = sineOutEase(startX, targetX, progress);
-                        actor->y = sineOutEase(startY, targetY, progress);
-						actor->z = sineOutEase(startZ, targetZ, progress);
-                        break;
-                }
+                tweenField(&actor->x, targetX);
+                tweenField(&actor->y, targetY);
+                tweenField(&actor->z, targetZ);
             }
     };
 
-    class Tween_ScaleXY: public Tween {
+    class Tween_ScaleXY: public FieldTween {
         public:
             float startScaleX;
             float startScaleY;
@@ -157,31 +94,11 @@ namespace Amara {
             }
             Tween_ScaleXY(float ts, double tt): Tween_ScaleXY(ts, tt, LINEAR) {}
 
-            void prepare(Amara::Actor* actor) {
+            void prepareFields(Amara::Actor* actor) {
                 startScaleX = actor->scaleX;
                 startScaleY = actor->scaleY;
-            }
-
-            void script(Amara::Actor* actor) {
-                Amara::Tween::progressFurther();
-                switch (easing) {
-                    case LINEAR:
-                        actor->scaleX = linearEase(startScaleX, targetScale, progress);
-                        actor->scaleY = linearEase(startScaleY, targetScale, progress);
-                        break;
-                    case SINE_INOUT:
-                        actor->scaleX = sineInOutEase(startScaleX, targetScale, progress);
-                        actor->scaleY = sineInOutEase(startScaleY, targetScale, progress);
-                        break;
-                    case SINE_IN:
-                        actor->scaleX = sineInEase(startScaleX, targetScale, progress);
-                        actor->scaleY = sineInEase(startScaleY, targetScale, progress);
-                        break;
-                    case SINE_OUT:
-                        actor->scaleX = sineOutEase(startScaleX, targetScale, progress);
-                        actor->scaleY = sineOutEase(startScaleY, targetScale, progress);
-                        break;
-                }
+                tweenField(&actor->scaleX, targetScale);
+                tweenField(&actor->scaleY, targetScale);
             }
     };
 
@@ -221,26 +138,8 @@ namespace Amara {
 
             void script(Amara::Actor* actor) {
                 Amara::Tween::progressFurther();
-                float shakeAmountX;
-                float shakeAmountY;
-                switch (easing) {
-                    case LINEAR:
-                        shakeAmountX = linearEase(maxShakeX, 0, progress);
-                        shakeAmountY = linearEase(maxShakeY, 0, progress);
-                        break;
-                    case SINE_INOUT:
-                        shakeAmountX = sineInOutEase(maxShakeX, 0, progress);
-                        shakeAmountY = sineInOutEase(maxShakeY, 0, progress);
-                        break;
-                    case SINE_IN:
-                        shakeAmountX = sineInEase(maxShakeX, 0, progress);
-                        shakeAmountY = sineInEase(maxShakeY, 0, progress);
-                        break;
-                    case SINE_OUT:
-                        shakeAmountX = sineOutEase(maxShakeX, 0, progress);
-                        shakeAmountY = sineOutEase(maxShakeY, 0, progress);
-                        break;
-                }
+                float shakeAmountX = ease(easing, maxShakeX, 0, progress);
+                float shakeAmountY = ease(easing, maxShakeY, 0, progress);
                 actor->x = startX + rng.random()*shakeAmountX - shakeAmountX/2.0;
                 actor->y = startY + rng.random()*shakeAmountY - shakeAmountY/2.0;
             }
@@ -281,21 +180,7 @@ namespace Amara {
 
             void script(Amara::Actor* actor) {
                 Amara::Tween::progressFurther();
-                float shakeAmount;
-                switch (easing) {
-                    case LINEAR:
-                        shakeAmount = linearEase(maxShake, 0, progress);
-                        break;
-                    case SINE_INOUT:
-                        shakeAmount = sineInOutEase(maxShake, 0, progress);
-                        break;
-                    case SINE_IN:
-                        shakeAmount = sineInEase(maxShake, 0, progress);
-                        break;
-                    case SINE_OUT:
-                        shakeAmount = sineOutEase(maxShake, 0, progress);
-                        break;
-                }
+                float shakeAmount = ease(easing, maxShake, 0, progress);
                 actor->x = startX + rng.random()*shakeAmount - shakeAmount/2.0;
             }
 
@@ -334,21 +219,7 @@ namespace Amara {
 
             void script(Amara::Actor* actor) {
                 Amara::Tween::progressFurther();
-                float shakeAmount;
-                switch (easing) {
-                    case LINEAR:
-                        shakeAmount = linearEase(maxShake, 0, progress);
-                        break;
-                    case SINE_INOUT:
-                        shakeAmount = sineInOutEase(maxShake, 0, progress);
-                        break;
-                    case SINE_IN:
-                        shakeAmount = sineInEase(maxShake, 0, progress);
-                        break;
-                    case SINE_OUT:
-                        shakeAmount = sineOutEase(maxShake, 0, progress);
-                        break;
-                }
+                float shakeAmount = ease(easing, maxShake, 0, progress);
                 actor->y = startY + rng.random()*shakeAmount - shakeAmount/2.0;
             }
 
@@ -357,7 +228,7 @@ namespace Amara {
 			}
     };
 
-    class Tween_Alpha: public Tween {
+    class Tween_Alpha: public FieldTween {
         public:
             float startAlpha = 0;
             float targetAlpha = 0;
@@ -370,30 +241,13 @@ namespace Amara {
             Tween_Alpha(float gTarget, float gTime): Tween_Alpha(gTarget, gTime, LINEAR) {}
             Tween_Alpha(float gTime): Tween_Alpha(0, gTime) {}
 
-            void prepare(Amara::Actor* actor) {
+            void prepareFields(Amara::Actor* actor) {
                 startAlpha = actor->alpha;
-            }
-
-            void script(Amara::Actor* actor) {
-                Amara::Tween::progressFurther();
-                switch (easing) {
-                    case LINEAR:
-                        actor->alpha = linearEase(startAlpha, targetAlpha, progress);
-                        break;
-                    case SINE_INOUT:
-                        actor->alpha = sineInOutEase(startAlpha, targetAlpha, progress);
-                        break;
-                    case SINE_IN:
-                        actor->alpha = sineInEase(startAlpha, targetAlpha, progress);
-                        break;
-                    case SINE_OUT:
-                        actor->alpha = sineOutEase(startAlpha, targetAlpha, progress);
-                        break;
-                }
+                tweenField(&actor->alpha, targetAlpha);
             }
 
             void finish() {
-                Tween::finish();
+                Amara::FieldTween::finish();
                 parent->alpha = targetAlpha;
             }
     };
@@ -17,6 +17,7 @@ namespace Amara {
             SDL_Rect srcRect;
             SDL_FRect destRect;
             SDL_FPoint origin;
+            SDL_FPoint noOrigin = { 0, 0 };
 
             bool pixelLocked = false;
 
@@ -289,12 +290,18 @@ namespace Amara {
                                 srcRect.h = partHeight;
                                 break;
                         }
-
-                        SDL_RenderCopyF(
-                            gRenderer,
-                            (SDL_Texture*)(texture->asset),
-                            &srcRect,
-                            &destRect
+                        srcRect.x += texture->offsetX;
+                        srcRect.y += texture->offsetY;
+
+                        properties->spriteBatch->draw(
+                            tx,
+                            SDL_BLENDMODE_BLEND,
+                            srcRect,
+                            destRect,
+                            0,
+                            noOrigin,
+                            SDL_FLIP_NONE,
+                            (Uint8)255
                         );
                     }
                 }
@@ -319,15 +326,17 @@ namespace Amara {
                 }
                 
                 SDL_Texture* recTarget = SDL_GetRenderTarget(properties->gRenderer);
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, canvas);
                 SDL_SetTextureBlendMode(canvas, SDL_BLENDMODE_BLEND);
                 SDL_SetTextureAlphaMod(canvas, 255);
                 SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 0);
                 SDL_RenderClear(gRenderer);
-                SDL_RenderSetViewport(properties->gRenderer, NULL);
+                properties->spriteBatch->setFullViewport();
                 for (int i = 0; i < 9; i++) {
                     drawBoxPart(i);
                 }
+                Amara::SpriteBatch::flush(properties);
                 SDL_SetRenderTarget(properties->gRenderer, recTarget);
 
                 bool skipDrawing = false;
@@ -339,13 +348,15 @@ namespace Amara {
                 viewport.y = vy;
                 viewport.w = vw;
                 viewport.h = vh;
+                Amara::SpriteBatch::flush(properties);
                 SDL_RenderSetViewport(properties->gRenderer, &viewport);
 
-                float nzoomX = 1 + (properties->zoomX-1)*zoomFactorX*properties->zoomFactorX;
-                float nzoomY = 1 + (properties->zoomY-1)*zoomFactorY*properties->zoomFactorY;
+                Amara::Transform transform = getDrawTransform();
+                float nzoomX = transform.getZoomX(zoomFactorX);
+                float nzoomY = transform.getZoomY(zoomFactorY);
 
-                destRect.x = ((x*scaleX - properties->scrollX*scrollFactorX + properties->offsetX - (originX * width * scaleX)) * nzoomX);
-                destRect.y = ((y*scaleY - properties->scrollY*scrollFactorY + properties->offsetY - (originY * height * scaleY)) * nzoomY);
+                destRect.x = ((transform.getScreenX(x*scaleX, scrollFactorX) - (originX * width * scaleX)) * nzoomX);
+                destRect.y = ((transform.getScreenY(y*scaleY, scrollFactorY) - (originY * height * scaleY)) * nzoomY);
                 destRect.w = ((width * scaleX) * nzoomX);
                 destRect.h = ((height * scaleY) * nzoomY);
 
@@ -392,14 +403,14 @@ namespace Amara {
 
                     if (canvas != nullptr) {
                         SDL_SetTextureBlendMode(canvas, blendMode);
-				        SDL_SetTextureAlphaMod(canvas, alpha * properties->alpha * 255);
+				        SDL_SetTextureAlphaMod(canvas, alpha * transform.alpha * 255);
 
                         SDL_RenderCopyExF(
                             properties->gRenderer,
                             canvas,
                             NULL,
                             &destRect,
-                            angle + properties->angle,
+                            angle + transform.angle,
                             &origin,
                             SDL_FLIP_NONE
                         );
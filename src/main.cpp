@@ -27,7 +27,7 @@ class TestScene: public Scene {
             box->setText(stringWithFormat(format, ernie.c_str()));
             box->txt->setColor(0, 0, 0);
             box->setProgressive();
-            box->id = "TEXTBOX";
+            box->setId("TEXTBOX");
 
             box->setOrigin(0.5);
             box->x = game->resolution->width/2;